@@ -0,0 +1,98 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_BENCH_H__
+#define __REFLECTION_BENCH_H__
+
+#include <stdint.h>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#define BENCH_CONCATEXT( a, b ) a##b
+#define BENCH_CONCAT( a, b ) BENCH_CONCATEXT( a, b )
+
+#define BENCHMARK( name )                                                                       \
+    static void name();                                                                         \
+    static Bench::Registrar BENCH_CONCAT( gBenchRegistrar, name )( #name, name );               \
+    static void name()
+
+namespace Bench
+{
+    typedef void ( *Function )();
+
+    struct Case
+    {
+        const char *name;
+        Function function;
+    };
+
+    inline std::vector< Case > &GetCases()
+    {
+        static std::vector< Case > cases;
+        return cases;
+    }
+
+    struct Registrar
+    {
+        Registrar( const char *name, Function function )
+        {
+            GetCases().push_back( { name, function } );
+        }
+    };
+
+    template< typename tT >
+    inline void DoNotOptimize( const tT &value )
+    {
+#if defined( _MSC_VER )
+        static volatile const void *sink;
+        sink = &value;
+#else
+        asm volatile( "" : : "r,m"( value ) : "memory" );
+#endif
+    }
+
+    // Runs the function with the given repetition count and returns the elapsed nanoseconds per repetition
+    template< typename tFunction >
+    inline double Measure( uint64_t repetitions, tFunction function )
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        function( repetitions );
+
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration< double, std::nano >( end - start ).count() / static_cast< double >( repetitions );
+    }
+
+    inline void Report( const char *group, const char *name, double nanoseconds, const char *extra = "" )
+    {
+        printf( "%-28s %-40s %12.3f ns %s\n", group, name, nanoseconds, extra );
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,161 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/clone.h"
+
+#include "bench.h"
+
+#include <string>
+#include <vector>
+#include <new>
+
+namespace
+{
+    class Shipment
+    {
+    public:
+
+        uint64_t id;
+        uint64_t customer;
+        uint32_t weight;
+        uint16_t priority;
+        uint16_t zone;
+        double price;
+        double volume;
+        std::string carrier;
+        std::vector< uint32_t > items;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Shipment" );
+            mirror.Reflect( &Shipment::id, 0, "id" );
+            mirror.Reflect( &Shipment::customer, 1, "customer" );
+            mirror.Reflect( &Shipment::weight, 2, "weight" );
+            mirror.Reflect( &Shipment::priority, 3, "priority" );
+            mirror.Reflect( &Shipment::zone, 4, "zone" );
+            mirror.Reflect( &Shipment::price, 5, "price" );
+            mirror.Reflect( &Shipment::volume, 6, "volume" );
+            mirror.Reflect( &Shipment::carrier, 7, "carrier" );
+            mirror.Reflect( &Shipment::items, 8, "items" );
+        }
+    };
+
+    // Copies the properties one at a time through their setters, as a generic clone would without a plan
+    void CopyProperties( const ITypeDescription *type, void *destination, const void *source )
+    {
+        for ( AbstractProperty *property : type->GetProperties()->GetView() )
+        {
+            property->Set( destination, property->Get( const_cast< void * >( source ) ) );
+        }
+    }
+
+    const uint64_t gRepetitions = 2000000;
+}
+
+BENCHMARK( ReflectedClone )
+{
+    std::vector< Shipment > sources( 1024 );
+
+    for ( size_t i = 0; i < sources.size(); ++i )
+    {
+        sources[i] = { i, i * 7, static_cast< uint32_t >( i ), 1, static_cast< uint16_t >( i % 9 ), 0.5 * i, 2.0, "carrier",
+                       { 1, 2, 3 } };
+    }
+
+    std::vector< Shipment > destinations( sources.size() );
+    const ITypeDescription *type = Reflect::GetType< Shipment >();
+
+    const double byHand = Bench::Measure( gRepetitions, [&sources, &destinations]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            destinations[i & 1023] = sources[i & 1023];
+        }
+
+        Bench::DoNotOptimize( destinations.data() );
+    } );
+
+    const double properties = Bench::Measure( gRepetitions, [&sources, &destinations, type]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            CopyProperties( type, &destinations[i & 1023], &sources[i & 1023] );
+        }
+
+        Bench::DoNotOptimize( destinations.data() );
+    } );
+
+    const double plan = Bench::Measure( gRepetitions, [&sources, &destinations, type]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            Reflect::CopyInto( type, &destinations[i & 1023], &sources[i & 1023] );
+        }
+
+        Bench::DoNotOptimize( destinations.data() );
+    } );
+
+    Bench::Report( "ReflectedClone", "operator= by hand", byHand );
+    Bench::Report( "ReflectedClone", "AbstractProperty::Set per property", properties );
+    Bench::Report( "ReflectedClone", "Reflect::CopyInto", plan );
+
+    // cloning a whole batch into uninitialised storage, per object
+    std::vector< uint8_t > storage( sources.size() * sizeof( Shipment ) + alignof( Shipment ) );
+    Shipment *clones = reinterpret_cast< Shipment * >( ( reinterpret_cast< uintptr_t >( storage.data() ) + alignof( Shipment ) - 1 ) &
+                                                       ~( alignof( Shipment ) - 1 ) );
+
+    const double batchProperties = Bench::Measure( 2000, [&sources, clones, type]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            for ( size_t j = 0; j < sources.size(); ++j )
+            {
+                CopyProperties( type, new( clones + j ) Shipment, &sources[j] );
+            }
+
+            for ( size_t j = 0; j < sources.size(); ++j )
+            {
+                clones[j].~Shipment();
+            }
+        }
+    } );
+
+    const double batch = Bench::Measure( 2000, [&sources, clones, type]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            Reflect::CloneInto( type, clones, sources.data(), sources.size() );
+
+            for ( size_t j = 0; j < sources.size(); ++j )
+            {
+                clones[j].~Shipment();
+            }
+        }
+    } );
+
+    Bench::Report( "ReflectedClone", "Batch of 1024 per property", batchProperties );
+    Bench::Report( "ReflectedClone", "Batch of 1024 Reflect::CloneInto", batch );
+}
\ No newline at end of file
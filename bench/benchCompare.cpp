@@ -0,0 +1,197 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/compare.h"
+
+#include "bench.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace
+{
+    class Route
+    {
+    public:
+
+        uint64_t source;
+        uint64_t target;
+        uint32_t port;
+        uint16_t protocol;
+        uint16_t zone;
+        double weight;
+        std::string label;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Route" );
+            mirror.Reflect( &Route::source, 0, "source" );
+            mirror.Reflect( &Route::target, 1, "target" );
+            mirror.Reflect( &Route::port, 2, "port" );
+            mirror.Reflect( &Route::protocol, 3, "protocol" );
+            mirror.Reflect( &Route::zone, 4, "zone" );
+            mirror.Reflect( &Route::weight, 5, "weight" );
+            mirror.Reflect( &Route::label, 6, "label" );
+        }
+
+        bool operator==( const Route &other ) const
+        {
+            return source == other.source && target == other.target && port == other.port &&
+                   protocol == other.protocol && zone == other.zone && weight == other.weight && label == other.label;
+        }
+    };
+
+    // The usual hand-written functor, combining the standard hashes of the members
+    struct RouteHash
+    {
+        static void Combine( size_t &seed, size_t hash )
+        {
+            seed ^= hash + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+        }
+
+        size_t operator()( const Route &route ) const
+        {
+            size_t seed = 0;
+            Combine( seed, std::hash< uint64_t >()( route.source ) );
+            Combine( seed, std::hash< uint64_t >()( route.target ) );
+            Combine( seed, std::hash< uint32_t >()( route.port ) );
+            Combine( seed, std::hash< uint16_t >()( route.protocol ) );
+            Combine( seed, std::hash< uint16_t >()( route.zone ) );
+            Combine( seed, std::hash< double >()( route.weight ) );
+            Combine( seed, std::hash< std::string >()( route.label ) );
+            return seed;
+        }
+    };
+
+    const uint64_t gRepetitions = 4000000;
+}
+
+BENCHMARK( ReflectedHash )
+{
+    std::vector< Route > routes( 1024 );
+
+    for ( size_t i = 0; i < routes.size(); ++i )
+    {
+        routes[i] = { i, i * 31, static_cast< uint32_t >( 8000 + i ), 6, static_cast< uint16_t >( i % 7 ), 0.5 * i,
+                      "route-" + std::to_string( i ) };
+    }
+
+    const RouteHash byHand;
+    const Reflect::Hasher< Route > reflected;
+
+    const double hashByHand = Bench::Measure( gRepetitions, [&routes, &byHand]( uint64_t count )
+    {
+        size_t sum = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            sum += byHand( routes[i & 1023] );
+        }
+
+        Bench::DoNotOptimize( sum );
+    } );
+
+    const double hash = Bench::Measure( gRepetitions, [&routes, &reflected]( uint64_t count )
+    {
+        size_t sum = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            sum += reflected( routes[i & 1023] );
+        }
+
+        Bench::DoNotOptimize( sum );
+    } );
+
+    Bench::Report( "ReflectedHash", "Hash by hand with std::hash", hashByHand );
+    Bench::Report( "ReflectedHash", "Reflect::Hasher", hash );
+
+    const std::vector< Route > copies = routes;
+    const Reflect::EqualTo< Route > equalTo;
+
+    const double equalByHand = Bench::Measure( gRepetitions, [&routes, &copies]( uint64_t count )
+    {
+        size_t equal = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            equal += routes[i & 1023] == copies[i & 1023];
+        }
+
+        Bench::DoNotOptimize( equal );
+    } );
+
+    const double equal = Bench::Measure( gRepetitions, [&routes, &copies, &equalTo]( uint64_t count )
+    {
+        size_t equal = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            equal += equalTo( routes[i & 1023], copies[i & 1023] );
+        }
+
+        Bench::DoNotOptimize( equal );
+    } );
+
+    Bench::Report( "ReflectedHash", "operator== by hand", equalByHand );
+    Bench::Report( "ReflectedHash", "Reflect::EqualTo", equal );
+
+    // a large trivially copyable run
+    std::vector< uint8_t > block( 1 << 16, 0x5a );
+
+    const double bytes = Bench::Measure( 2000, [&block]( uint64_t count )
+    {
+        uint64_t sum = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            sum += ReflectionHelper::HashBytes( block.data(), block.size(), i );
+        }
+
+        Bench::DoNotOptimize( sum );
+    } );
+
+    const double blocks = Bench::Measure( 2000, [&block]( uint64_t count )
+    {
+        uint64_t sum = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            sum += ReflectionHelper::HashBlocks( block.data(), block.size(), i );
+        }
+
+        Bench::DoNotOptimize( sum );
+    } );
+
+    char bytesRate[64];
+    char blocksRate[64];
+    snprintf( bytesRate, sizeof( bytesRate ), "(%.0f MB/s)", block.size() * 1000.0 / bytes );
+    snprintf( blocksRate, sizeof( blocksRate ), "(%.0f MB/s)", block.size() * 1000.0 / blocks );
+
+    Bench::Report( "ReflectedHash", "HashBytes 64 KiB", bytes, bytesRate );
+    Bench::Report( "ReflectedHash", "HashBlocks 64 KiB", blocks, blocksRate );
+}
\ No newline at end of file
@@ -0,0 +1,239 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/delta.h"
+
+#include "bench.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    // A replicated game object with 40 reflected properties
+    class Player
+    {
+    public:
+
+        uint64_t id;
+        float x;
+        float y;
+        float z;
+        float vx;
+        float vy;
+        float vz;
+        float yaw;
+        float pitch;
+        float roll;
+        float health;
+        float armor;
+        float stamina;
+        float mana;
+        float speed;
+        float scale;
+        float heat;
+        int32_t team;
+        int32_t level;
+        int32_t experience;
+        int32_t gold;
+        int32_t kills;
+        int32_t deaths;
+        int32_t assists;
+        int32_t target;
+        int32_t weapon;
+        int32_t ammo;
+        int32_t clip;
+        int32_t grenades;
+        int32_t state;
+        int32_t animation;
+        int32_t frame;
+        int32_t zone;
+        int32_t region;
+        int32_t shard;
+        int32_t ping;
+        int32_t score;
+        std::string name;
+        std::vector< uint32_t > buffs;
+        std::vector< uint32_t > inventory;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Player" );
+            mirror.Reflect( &Player::id, 0, "id" );
+            mirror.Reflect( &Player::x, 1, "x" );
+            mirror.Reflect( &Player::y, 2, "y" );
+            mirror.Reflect( &Player::z, 3, "z" );
+            mirror.Reflect( &Player::vx, 4, "vx" );
+            mirror.Reflect( &Player::vy, 5, "vy" );
+            mirror.Reflect( &Player::vz, 6, "vz" );
+            mirror.Reflect( &Player::yaw, 7, "yaw" );
+            mirror.Reflect( &Player::pitch, 8, "pitch" );
+            mirror.Reflect( &Player::roll, 9, "roll" );
+            mirror.Reflect( &Player::health, 10, "health" );
+            mirror.Reflect( &Player::armor, 11, "armor" );
+            mirror.Reflect( &Player::stamina, 12, "stamina" );
+            mirror.Reflect( &Player::mana, 13, "mana" );
+            mirror.Reflect( &Player::speed, 14, "speed" );
+            mirror.Reflect( &Player::scale, 15, "scale" );
+            mirror.Reflect( &Player::heat, 16, "heat" );
+            mirror.Reflect( &Player::team, 17, "team" );
+            mirror.Reflect( &Player::level, 18, "level" );
+            mirror.Reflect( &Player::experience, 19, "experience" );
+            mirror.Reflect( &Player::gold, 20, "gold" );
+            mirror.Reflect( &Player::kills, 21, "kills" );
+            mirror.Reflect( &Player::deaths, 22, "deaths" );
+            mirror.Reflect( &Player::assists, 23, "assists" );
+            mirror.Reflect( &Player::target, 24, "target" );
+            mirror.Reflect( &Player::weapon, 25, "weapon" );
+            mirror.Reflect( &Player::ammo, 26, "ammo" );
+            mirror.Reflect( &Player::clip, 27, "clip" );
+            mirror.Reflect( &Player::grenades, 28, "grenades" );
+            mirror.Reflect( &Player::state, 29, "state" );
+            mirror.Reflect( &Player::animation, 30, "animation" );
+            mirror.Reflect( &Player::frame, 31, "frame" );
+            mirror.Reflect( &Player::zone, 32, "zone" );
+            mirror.Reflect( &Player::region, 33, "region" );
+            mirror.Reflect( &Player::shard, 34, "shard" );
+            mirror.Reflect( &Player::ping, 35, "ping" );
+            mirror.Reflect( &Player::score, 36, "score" );
+            mirror.Reflect( &Player::name, 37, "name" );
+            mirror.Reflect( &Player::buffs, 38, "buffs" );
+            mirror.Reflect( &Player::inventory, 39, "inventory" );
+        }
+    };
+
+    const size_t gPlayerCount = 10000;
+    const uint64_t gTickCount = 100;
+}
+
+BENCHMARK( DeltaReplication )
+{
+    std::vector< Player > baselines( gPlayerCount );
+
+    for ( size_t i = 0; i < gPlayerCount; ++i )
+    {
+        Player &player = baselines[i];
+        player = Player();
+        player.id = i;
+        player.name = "player" + std::to_string( i );
+        player.buffs = { 1, 2, 3 };
+        player.inventory = std::vector< uint32_t >( 16, static_cast< uint32_t >( i ) );
+    }
+
+    std::vector< Player > states = baselines;
+    std::vector< Player > replicas = baselines;
+
+    const ITypeDescription *type = Reflect::GetType< Player >();
+    std::vector< uint8_t > buffer;
+    buffer.reserve( gPlayerCount * 512 );
+
+    // a tick moves every player, and changes the ammo of every fourth one
+    auto tick = [&states]( uint64_t t )
+    {
+        for ( size_t i = 0; i < gPlayerCount; ++i )
+        {
+            states[i].x += 0.5f;
+            states[i].yaw = static_cast< float >( t );
+
+            if ( ( i & 3 ) == 0 )
+            {
+                --states[i].ammo;
+            }
+        }
+    };
+
+    size_t fullBytes = 0;
+
+    const double full = Bench::Measure( gTickCount * gPlayerCount, [&]( uint64_t count )
+    {
+        for ( uint64_t t = 0; t < count / gPlayerCount; ++t )
+        {
+            tick( t );
+            buffer.clear();
+            BinaryWriter writer( buffer );
+
+            for ( size_t i = 0; i < gPlayerCount; ++i )
+            {
+                Reflect::Serialize( type, &states[i], writer );
+            }
+
+            fullBytes = buffer.size();
+            BinaryReader reader( buffer.data(), buffer.size() );
+
+            for ( size_t i = 0; i < gPlayerCount; ++i )
+            {
+                Reflect::Deserialize( type, &replicas[i], reader );
+            }
+        }
+
+        Bench::DoNotOptimize( replicas.data() );
+    } );
+
+    size_t deltaBytes = 0;
+
+    const double delta = Bench::Measure( gTickCount * gPlayerCount, [&]( uint64_t count )
+    {
+        for ( uint64_t t = 0; t < count / gPlayerCount; ++t )
+        {
+            tick( t );
+            buffer.clear();
+            BinaryWriter writer( buffer );
+
+            for ( size_t i = 0; i < gPlayerCount; ++i )
+            {
+                Reflect::WriteDelta( type, &baselines[i], &states[i], writer );
+            }
+
+            deltaBytes = buffer.size();
+            BinaryReader reader( buffer.data(), buffer.size() );
+            BinaryReader sent( buffer.data(), buffer.size() );
+
+            // the baselines follow the replicas by applying the same deltas, which copies only what changed
+            for ( size_t i = 0; i < gPlayerCount; ++i )
+            {
+                Reflect::ApplyDelta( type, &replicas[i], reader );
+                Reflect::ApplyDelta( type, &baselines[i], sent );
+            }
+        }
+
+        Bench::DoNotOptimize( replicas.data() );
+    } );
+
+    // at a million objects per second the bytes per object are the megabytes per second, and every nanosecond per
+    // object is a thousandth of a core
+    const double fullSize = fullBytes / static_cast< double >( gPlayerCount );
+    const double deltaSize = deltaBytes / static_cast< double >( gPlayerCount );
+
+    char fullExtra[96];
+    char deltaExtra[96];
+    snprintf( fullExtra, sizeof( fullExtra ), "(%.1f bytes, %.1f MB/s, %.0f%% core at 1M/s)", fullSize, fullSize,
+              full / 10.0 );
+    snprintf( deltaExtra, sizeof( deltaExtra ), "(%.1f bytes, %.1f MB/s, %.0f%% core at 1M/s)", deltaSize, deltaSize,
+              delta / 10.0 );
+
+    Bench::Report( "DeltaReplication", "Serialize and Deserialize", full, fullExtra );
+    Bench::Report( "DeltaReplication", "WriteDelta and ApplyDelta", delta, deltaExtra );
+}
\ No newline at end of file
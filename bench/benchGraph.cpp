@@ -0,0 +1,164 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/graph.h"
+
+#include "bench.h"
+
+#include <unordered_map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    class Part
+    {
+    public:
+
+        Part()
+            : id( 0 ),
+              mass( 0.0 ),
+              owner( nullptr )
+        {
+        }
+
+        uint64_t id;
+        double mass;
+        std::string name;
+        Part *owner;
+        std::vector< Part * > links;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Part" );
+            mirror.Reflect( &Part::id, 0, "id" );
+            mirror.Reflect( &Part::mass, 1, "mass" );
+            mirror.Reflect( &Part::name, 2, "name" );
+            mirror.Reflect( &Part::owner, 3, "owner" );
+            mirror.Reflect( &Part::links, 4, "links" );
+        }
+    };
+
+    const size_t gParts = 10000;
+}
+
+BENCHMARK( ReflectedGraph )
+{
+    // every part links to four others and to the part owning it, so most parts are reached many times
+    std::vector< Part > parts( gParts );
+    uint64_t random = 1;
+
+    for ( size_t i = 0; i < parts.size(); ++i )
+    {
+        parts[i].id = i;
+        parts[i].mass = 0.25 * i;
+        parts[i].name = "part";
+        parts[i].owner = &parts[i / 8];
+
+        for ( size_t j = 0; j < 4; ++j )
+        {
+            random = random * 6364136223846793005ull + 1442695040888963407ull;
+            parts[i].links.push_back( &parts[( random >> 33 ) % parts.size()] );
+        }
+    }
+
+    // the root reaches every part
+    Part root;
+
+    for ( Part &part : parts )
+    {
+        root.links.push_back( &part );
+    }
+
+    std::vector< uint8_t > buffer;
+
+    const double write = Bench::Measure( 20, [&root, &buffer]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            buffer.clear();
+            Reflect::WriteGraph( root, buffer );
+        }
+
+        Bench::DoNotOptimize( buffer.data() );
+    } );
+
+    const double read = Bench::Measure( 20, [&buffer]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            ObjectArena arena;
+            Part loaded;
+            Reflect::ReadGraph( buffer, loaded, arena );
+            Bench::DoNotOptimize( &loaded );
+        }
+    } );
+
+    Bench::Report( "ReflectedGraph", "WriteGraph of 10000 shared parts", write );
+    Bench::Report( "ReflectedGraph", "ReadGraph of 10000 shared parts", read );
+
+    // assigning identifiers to the links, which is what the writer does for every pointer
+    const double table = Bench::Measure( 20, [&parts]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            ObjectTable ids;
+            uint32_t next = 1;
+
+            for ( const Part &part : parts )
+            {
+                for ( const Part *link : part.links )
+                {
+                    next += ids.Insert( link, next ) == next;
+                }
+            }
+
+            Bench::DoNotOptimize( next );
+        }
+    } );
+
+    const double map = Bench::Measure( 20, [&parts]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            std::unordered_map< const void *, uint32_t > ids;
+            uint32_t next = 1;
+
+            for ( const Part &part : parts )
+            {
+                for ( const Part *link : part.links )
+                {
+                    next += ids.emplace( link, next ).first->second == next;
+                }
+            }
+
+            Bench::DoNotOptimize( next );
+        }
+    } );
+
+    Bench::Report( "ReflectedGraph", "40000 identifiers with ObjectTable", table );
+    Bench::Report( "ReflectedGraph", "40000 identifiers with unordered_map", map );
+}
\ No newline at end of file
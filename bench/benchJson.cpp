@@ -0,0 +1,300 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/json.h"
+
+#include "bench.h"
+
+#include <stdlib.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    class Quote
+    {
+    public:
+
+        uint64_t id;
+        uint32_t account;
+        uint32_t quantity;
+        double price;
+        double limit;
+        std::string symbol;
+        std::vector< double > fills;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Quote" );
+            mirror.Reflect( &Quote::id, 0, "id" );
+            mirror.Reflect( &Quote::account, 1, "account" );
+            mirror.Reflect( &Quote::quantity, 2, "quantity" );
+            mirror.Reflect( &Quote::price, 3, "price" );
+            mirror.Reflect( &Quote::limit, 4, "limit" );
+            mirror.Reflect( &Quote::symbol, 5, "symbol" );
+            mirror.Reflect( &Quote::fills, 6, "fills" );
+        }
+    };
+
+    // The usual hand-written code, streaming through iostreams
+    void WriteByHand( const Quote &quote, std::string &buffer )
+    {
+        std::ostringstream stream;
+        stream.precision( 17 );
+
+        stream << "{\"id\":" << quote.id << ",\"account\":" << quote.account << ",\"quantity\":" << quote.quantity
+               << ",\"price\":" << quote.price << ",\"limit\":" << quote.limit << ",\"symbol\":\"" << quote.symbol
+               << "\",\"fills\":[";
+
+        for ( size_t i = 0; i < quote.fills.size(); ++i )
+        {
+            stream << ( i ? "," : "" ) << quote.fills[i];
+        }
+
+        stream << "]}";
+        buffer = stream.str();
+    }
+
+    // The usual hand-written code, comparing key strings and converting numbers with strtod
+    bool ReadByHand( std::string_view text, Quote &quote )
+    {
+        JsonReader reader( text );
+
+        if ( reader.Next() != JsonToken::BeginObject )
+        {
+            return false;
+        }
+
+        for ( JsonToken token = reader.Next(); token == JsonToken::Key; token = reader.Next() )
+        {
+            const std::string key( reader.GetString() );
+            token = reader.Next();
+
+            if ( key == "symbol" )
+            {
+                quote.symbol = std::string( reader.GetString() );
+                continue;
+            }
+
+            if ( key == "fills" )
+            {
+                quote.fills.clear();
+
+                for ( token = reader.Next(); token == JsonToken::Number; token = reader.Next() )
+                {
+                    double value;
+                    reader.GetDouble( value );
+                    quote.fills.push_back( value );
+                }
+
+                continue;
+            }
+
+            double value;
+            reader.GetDouble( value );
+
+            if ( key == "id" )
+            {
+                quote.id = static_cast< uint64_t >( value );
+            }
+            else if ( key == "account" )
+            {
+                quote.account = static_cast< uint32_t >( value );
+            }
+            else if ( key == "quantity" )
+            {
+                quote.quantity = static_cast< uint32_t >( value );
+            }
+            else if ( key == "price" )
+            {
+                quote.price = value;
+            }
+            else if ( key == "limit" )
+            {
+                quote.limit = value;
+            }
+        }
+
+        return !reader.HasError();
+    }
+
+    // Finds the structural characters one byte at a time
+    const char *FindStructuralByByte( const char *cursor, const char *end )
+    {
+        for ( ; cursor != end; ++cursor )
+        {
+            const char c = *cursor;
+
+            if ( c == '{' || c == '}' || c == '[' || c == ']' || c == '"' )
+            {
+                return cursor;
+            }
+        }
+
+        return end;
+    }
+
+    const uint64_t gMessageCount = 1000000;
+}
+
+BENCHMARK( Json )
+{
+    std::vector< Quote > quotes( 1024 );
+
+    for ( size_t i = 0; i < quotes.size(); ++i )
+    {
+        quotes[i] = { i, static_cast< uint32_t >( i * 7 ), 100, 1.25 * i, 2.5 * i, "SYM" + std::to_string( i % 10 ),
+                      std::vector< double >( i % 4, 0.5 ) };
+    }
+
+    const ITypeDescription *type = Reflect::GetType< Quote >();
+    std::string buffer;
+    buffer.reserve( 1 << 12 );
+
+    const double byHand = Bench::Measure( gMessageCount, [&quotes, &buffer]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            WriteByHand( quotes[i & 1023], buffer );
+        }
+
+        Bench::DoNotOptimize( buffer.data() );
+    } );
+
+    const double reflected = Bench::Measure( gMessageCount, [&quotes, &buffer, type]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            buffer.clear();
+            JsonWriter writer( buffer );
+            Reflect::WriteJson( type, &quotes[i & 1023], writer );
+        }
+
+        Bench::DoNotOptimize( buffer.data() );
+    } );
+
+    char extra[64];
+    snprintf( extra, sizeof( extra ), "(%zu bytes)", buffer.size() );
+
+    Bench::Report( "Json", "Write by hand with iostreams", byHand, extra );
+    Bench::Report( "Json", "Reflect::WriteJson", reflected );
+
+    Quote quote;
+
+    const double readByHand = Bench::Measure( gMessageCount, [&buffer, &quote]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            ReadByHand( buffer, quote );
+        }
+
+        Bench::DoNotOptimize( quote );
+    } );
+
+    const double readReflected = Bench::Measure( gMessageCount, [&buffer, &quote, type]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            JsonReader reader( buffer );
+            Reflect::ReadJson( type, &quote, reader );
+        }
+
+        Bench::DoNotOptimize( quote );
+    } );
+
+    Bench::Report( "Json", "Read by hand with string keys", readByHand );
+    Bench::Report( "Json", "Reflect::ReadJson", readReflected );
+
+    // a large document of nested arrays and long strings, as skipped by the reader
+    std::string document = "[";
+
+    while ( document.size() < ( 1 << 24 ) )
+    {
+        document += "{\"text\":\"" + std::string( 200, 'x' ) + "\",\"values\":[1.5,2.5,3.5,4.5,5.5,6.5,7.5]},";
+    }
+
+    document.back() = ']';
+
+    const double scanByByte = Bench::Measure( 8, [&document]( uint64_t count )
+    {
+        size_t structural = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            const char *end = document.data() + document.size();
+
+            for ( const char *cursor = document.data(); ( cursor = FindStructuralByByte( cursor, end ) ) != end; ++cursor )
+            {
+                ++structural;
+            }
+        }
+
+        Bench::DoNotOptimize( structural );
+    } );
+
+    const double scan = Bench::Measure( 8, [&document]( uint64_t count )
+    {
+        size_t structural = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            const char *end = document.data() + document.size();
+
+            for ( const char *cursor = document.data();
+                  ( cursor = ReflectionHelper::FindStructural( cursor, end ) ) != end; ++cursor )
+            {
+                ++structural;
+            }
+        }
+
+        Bench::DoNotOptimize( structural );
+    } );
+
+    const double skip = Bench::Measure( 8, [&document]( uint64_t count )
+    {
+        bool skipped = true;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            JsonReader reader( document );
+            skipped &= reader.SkipValue();
+        }
+
+        Bench::DoNotOptimize( skipped );
+    } );
+
+    char byByteRate[64];
+    char scanRate[64];
+    char skipRate[64];
+    snprintf( byByteRate, sizeof( byByteRate ), "(%.0f MB/s)", document.size() * 1000.0 / scanByByte );
+    snprintf( scanRate, sizeof( scanRate ), "(%.0f MB/s)", document.size() * 1000.0 / scan );
+    snprintf( skipRate, sizeof( skipRate ), "(%.0f MB/s)", document.size() * 1000.0 / skip );
+
+    Bench::Report( "Json", "Structural scan by byte", scanByByte, byByteRate );
+    Bench::Report( "Json", "ReflectionHelper::FindStructural", scan, scanRate );
+    Bench::Report( "Json", "JsonReader::SkipValue", skip, skipRate );
+}
\ No newline at end of file
@@ -0,0 +1,389 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/reflection.h"
+
+#include "bench.h"
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+    class Particle
+    {
+    public:
+
+        uint32_t id;
+        float mass;
+        uint64_t flags;
+        float velocity[3];
+
+        template< class tMirror >
+        static void Reflect( tMirror &mirror )
+        {
+            mirror.Reflect( "Particle" );
+            mirror.Reflect( &Particle::id, 0, "id" );
+            mirror.Reflect( &Particle::mass, 1, "mass" );
+            mirror.Reflect( &Particle::flags, 2, "flags" );
+        }
+    };
+
+    class Editable
+    {
+    public:
+
+        uint32_t a, b, c, d, e, f, g, h, i, j, k, l;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Editable" );
+            mirror.Reflect( &Editable::a, 0, Accessibility::Public, "a" );
+            mirror.Reflect( &Editable::b, 1, Accessibility::Private, "b" );
+            mirror.Reflect( &Editable::c, 2, Accessibility::Protected, "c" );
+            mirror.Reflect( &Editable::d, 3, Accessibility::Public, "d" );
+            mirror.Reflect( &Editable::e, 4, Accessibility::Private, "e" );
+            mirror.Reflect( &Editable::f, 5, Accessibility::Protected, "f" );
+            mirror.Reflect( &Editable::g, 6, Accessibility::Public, "g" );
+            mirror.Reflect( &Editable::h, 7, Accessibility::Private, "h" );
+            mirror.Reflect( &Editable::i, 8, Accessibility::Protected, "i" );
+            mirror.Reflect( &Editable::j, 9, Accessibility::Public, "j" );
+            mirror.Reflect( &Editable::k, 10, Accessibility::Private, "k" );
+            mirror.Reflect( &Editable::l, 11, Accessibility::Protected, "l" );
+        }
+    };
+
+    const size_t gObjectCount = 10000000;
+    const size_t gQueryCount = 2000000;
+
+    inline uint64_t Checksum( uint64_t checksum, const void *value, size_t size )
+    {
+        uint64_t bits = 0;
+        memcpy( &bits, value, size < sizeof( bits ) ? size : sizeof( bits ) );
+
+        return ( checksum ^ bits ) * 0x100000001b3ull;
+    }
+}
+
+BENCHMARK( PropertyFieldAccess )
+{
+    std::vector< Particle > particles( gObjectCount );
+    std::vector< Particle > copies( gObjectCount );
+
+    for ( size_t i = 0; i < gObjectCount; ++i )
+    {
+        particles[i] = { static_cast< uint32_t >( i ), static_cast< float >( i & 0xff ), i * 3, { 0.0f, 0.0f, 0.0f } };
+    }
+
+    const Properties< Particle > *properties = Reflect::GetType< Particle >()->GetProperties();
+    const AbstractProperty *mass = properties->GetByMemberPtr( &Particle::mass );
+    const AbstractProperty *flags = properties->GetByMemberPtr( &Particle::flags );
+
+    const double direct = Bench::Measure( gObjectCount, [&particles]( uint64_t count )
+    {
+        float sum = 0.0f;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            sum += particles[i].mass;
+        }
+
+        Bench::DoNotOptimize( sum );
+    } );
+
+    const double virtualGet = Bench::Measure( gObjectCount, [&particles, mass]( uint64_t count )
+    {
+        float sum = 0.0f;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            sum += *static_cast< float * >( mass->Get( &particles[i] ) );
+        }
+
+        Bench::DoNotOptimize( sum );
+    } );
+
+    const double offsetGet = Bench::Measure( gObjectCount, [&particles, mass]( uint64_t count )
+    {
+        float sum = 0.0f;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            sum += mass->At< float >( &particles[i] );
+        }
+
+        Bench::DoNotOptimize( sum );
+    } );
+
+    Bench::Report( "PropertyFieldAccess", "Direct member load", direct );
+    Bench::Report( "PropertyFieldAccess", "Virtual Get", virtualGet );
+    Bench::Report( "PropertyFieldAccess", "Byte offset load", offsetGet );
+
+    const double virtualCopy = Bench::Measure( gObjectCount, [&particles, &copies, flags]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            const_cast< AbstractProperty * >( flags )->Set( &copies[i], flags->Get( &particles[i] ) );
+        }
+
+        Bench::DoNotOptimize( copies.data() );
+    } );
+
+    const double offsetCopy = Bench::Measure( gObjectCount, [&particles, &copies, flags]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            flags->CopyValue( &copies[i], &particles[i] );
+        }
+
+        Bench::DoNotOptimize( copies.data() );
+    } );
+
+    Bench::Report( "PropertyFieldAccess", "Virtual Get + Set copy", virtualCopy );
+    Bench::Report( "PropertyFieldAccess", "Byte offset memcpy", offsetCopy );
+}
+
+BENCHMARK( StaticVisitor )
+{
+    std::vector< Particle > particles( gObjectCount );
+
+    for ( size_t i = 0; i < gObjectCount; ++i )
+    {
+        particles[i] = { static_cast< uint32_t >( i ), static_cast< float >( i & 0xff ), i * 3, { 0.0f, 0.0f, 0.0f } };
+    }
+
+    ArrayView< AbstractProperty * > properties = Reflect::GetType< Particle >()->GetProperties()->GetView();
+
+    const double runtime = Bench::Measure( gObjectCount, [&particles, properties]( uint64_t count )
+    {
+        uint64_t checksum = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            for ( AbstractProperty *property : properties )
+            {
+                checksum = Checksum( checksum, property->Get( &particles[i] ), property->GetSize() );
+            }
+        }
+
+        Bench::DoNotOptimize( checksum );
+    } );
+
+    const double visitor = Bench::Measure( gObjectCount, [&particles]( uint64_t count )
+    {
+        uint64_t checksum = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            Reflect::ForEachProperty( particles[i], [&checksum]( const auto &value, const StaticProperty & )
+            {
+                checksum = Checksum( checksum, &value, sizeof( value ) );
+            } );
+        }
+
+        Bench::DoNotOptimize( checksum );
+    } );
+
+    Bench::Report( "StaticVisitor", "Runtime properties (per object)", runtime );
+    Bench::Report( "StaticVisitor", "ForEachProperty (per object)", visitor );
+}
+
+BENCHMARK( PropertyGather )
+{
+    std::vector< Particle > particles( gObjectCount );
+    std::vector< Particle > copies( gObjectCount );
+    std::vector< float > masses( gObjectCount );
+    std::vector< uint64_t > flags( gObjectCount );
+
+    for ( size_t i = 0; i < gObjectCount; ++i )
+    {
+        particles[i] = { static_cast< uint32_t >( i ), static_cast< float >( i & 0xff ), i * 3, { 0.0f, 0.0f, 0.0f } };
+    }
+
+    const Properties< Particle > *properties = Reflect::GetType< Particle >()->GetProperties();
+    const Property< Particle, float > *mass = properties->GetByMemberPtr( &Particle::mass );
+    const Property< Particle, uint64_t > *flag = properties->GetByMemberPtr( &Particle::flags );
+
+    const double virtualGet = Bench::Measure( gObjectCount, [&particles, &masses, mass]( uint64_t count )
+    {
+        const AbstractProperty *property = mass;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            masses[i] = *static_cast< float * >( property->Get( &particles[i] ) );
+        }
+
+        Bench::DoNotOptimize( masses.data() );
+    } );
+
+    const double gather = Bench::Measure( gObjectCount, [&particles, &masses, mass]( uint64_t count )
+    {
+        mass->Gather( particles.data(), count, masses.data() );
+        Bench::DoNotOptimize( masses.data() );
+    } );
+
+    const double gatherWide = Bench::Measure( gObjectCount, [&particles, &flags, flag]( uint64_t count )
+    {
+        flag->Gather( particles.data(), count, flags.data() );
+        Bench::DoNotOptimize( flags.data() );
+    } );
+
+    const double scatter = Bench::Measure( gObjectCount, [&copies, &masses, mass]( uint64_t count )
+    {
+        mass->Scatter( masses.data(), copies.data(), count );
+        Bench::DoNotOptimize( copies.data() );
+    } );
+
+    const double copy = Bench::Measure( gObjectCount, [&particles, &copies]( uint64_t count )
+    {
+        memcpy( copies.data(), particles.data(), count * sizeof( Particle ) );
+        Bench::DoNotOptimize( copies.data() );
+    } );
+
+    char extra[64];
+    snprintf( extra, sizeof( extra ), "(%.2f GB/s of objects)", sizeof( Particle ) / gather );
+
+    Bench::Report( "PropertyGather", "Virtual Get loop (float)", virtualGet );
+    Bench::Report( "PropertyGather", "Gather (float)", gather, extra );
+    Bench::Report( "PropertyGather", "Gather (uint64_t)", gatherWide );
+    Bench::Report( "PropertyGather", "Scatter (float)", scatter );
+
+    snprintf( extra, sizeof( extra ), "(%.2f GB/s)", sizeof( Particle ) / copy );
+    Bench::Report( "PropertyGather", "memcpy of the objects", copy, extra );
+}
+
+BENCHMARK( AccessibilityQuery )
+{
+    typedef AbstractProperties::AccessibilityType Type;
+    const AbstractProperties *properties = Reflect::GetType< Editable >()->GetProperties();
+
+    // the per call filtering that the partitions replace
+    const double filter = Bench::Measure( gQueryCount, [properties]( uint64_t count )
+    {
+        size_t total = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            std::vector< AbstractProperty * > matches;
+
+            for ( AbstractProperty *property : properties->GetView() )
+            {
+                if ( property->GetAccessibility() != Accessibility::Protected )
+                {
+                    matches.push_back( property );
+                }
+            }
+
+            total += matches.size();
+        }
+
+        Bench::DoNotOptimize( total );
+    } );
+
+    const double all = Bench::Measure( gQueryCount, [properties]( uint64_t count )
+    {
+        size_t total = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            total += properties->GetAll( Accessibility::Protected, Type::NotEqual ).size();
+        }
+
+        Bench::DoNotOptimize( total );
+    } );
+
+    const double view = Bench::Measure( gQueryCount, [properties]( uint64_t count )
+    {
+        size_t total = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            total += properties->GetAccessibleView( Accessibility::Protected, Type::NotEqual ).size();
+        }
+
+        Bench::DoNotOptimize( total );
+    } );
+
+    Bench::Report( "AccessibilityQuery", "Filter over GetView (NotEqual)", filter );
+    Bench::Report( "AccessibilityQuery", "GetAll (NotEqual)", all );
+    Bench::Report( "AccessibilityQuery", "GetAccessibleView (NotEqual)", view );
+}
+
+BENCHMARK( TypedQuery )
+{
+    const Properties< Editable > *properties = Reflect::GetType< Editable >()->GetProperties();
+
+    // the per call comparison that the buckets replace
+    const double filter = Bench::Measure( gQueryCount, [properties]( uint64_t count )
+    {
+        size_t total = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            std::vector< Property< Editable, uint32_t > * > matches;
+
+            for ( AbstractProperty *property : properties->GetView() )
+            {
+                if ( property->GetType() == std::type_index( typeid( uint32_t ) ) )
+                {
+                    matches.push_back( static_cast< Property< Editable, uint32_t > * >( property ) );
+                }
+            }
+
+            total += matches.size();
+        }
+
+        Bench::DoNotOptimize( total );
+    } );
+
+    const double all = Bench::Measure( gQueryCount, [properties]( uint64_t count )
+    {
+        size_t total = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            total += properties->GetAll< uint32_t >().size();
+        }
+
+        Bench::DoNotOptimize( total );
+    } );
+
+    const double view = Bench::Measure( gQueryCount, [properties]( uint64_t count )
+    {
+        size_t total = 0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            total += properties->GetTypedView< uint32_t >().size();
+        }
+
+        Bench::DoNotOptimize( total );
+    } );
+
+    Bench::Report( "TypedQuery", "type_index filter over GetView", filter );
+    Bench::Report( "TypedQuery", "GetAll< uint32_t >", all );
+    Bench::Report( "TypedQuery", "GetTypedView< uint32_t >", view );
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/reflectedVector.h"
+
+#include "bench.h"
+
+#include <vector>
+
+namespace
+{
+    class WideRecord
+    {
+    public:
+
+        uint64_t id;
+        float score;
+        float weights[12];
+        uint64_t timestamp;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "WideRecord" );
+            mirror.Reflect( &WideRecord::id, 0, "id" );
+            mirror.Reflect( &WideRecord::score, 1, "score" );
+            mirror.Reflect( &WideRecord::timestamp, 2, "timestamp" );
+        }
+    };
+
+    const size_t gRecordCount = 10000000;
+}
+
+BENCHMARK( ReflectedVectorScan )
+{
+    std::vector< WideRecord > records( gRecordCount );
+    ReflectedVector< WideRecord > columns;
+    columns.reserve( gRecordCount );
+
+    for ( size_t i = 0; i < gRecordCount; ++i )
+    {
+        records[i].id = i;
+        records[i].score = static_cast< float >( i & 0xff );
+        records[i].timestamp = i * 10;
+        columns.push_back( records[i] );
+    }
+
+    const double arrayOfStructures = Bench::Measure( gRecordCount, [&records]( uint64_t count )
+    {
+        float sum = 0.0f;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            sum += records[i].score;
+        }
+
+        Bench::DoNotOptimize( sum );
+    } );
+
+    const double structureOfArrays = Bench::Measure( gRecordCount, [&columns]( uint64_t count )
+    {
+        const float *scores = columns.GetColumnByMemberPtr( &WideRecord::score );
+        float sum = 0.0f;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            sum += scores[i];
+        }
+
+        Bench::DoNotOptimize( sum );
+    } );
+
+    char extra[64];
+    snprintf( extra, sizeof( extra ), "(%zu byte records)", sizeof( WideRecord ) );
+
+    Bench::Report( "ReflectedVectorScan", "std::vector< T > field scan", arrayOfStructures, extra );
+    Bench::Report( "ReflectedVectorScan", "ReflectedVector< T > column scan", structureOfArrays );
+}
\ No newline at end of file
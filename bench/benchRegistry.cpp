@@ -0,0 +1,391 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/reflection.h"
+
+#include "bench.h"
+
+#include <unordered_map>
+#include <string_view>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    template< uint32_t tN >
+    class LookupType
+    {
+    public:
+
+        uint32_t value;
+
+        static void Reflect( Mirror &mirror )
+        {
+            static const std::string name = "LookupType" + std::to_string( tN );
+
+            mirror.Reflect( name.c_str() );
+            mirror.Reflect( &LookupType::value, 0 );
+        }
+    };
+
+    enum class Channel : uint8_t
+    {
+        Red,
+        Green
+    };
+
+    // A class with the usual mix of primitive properties
+    class Sample
+    {
+    public:
+
+        uint8_t u8;
+        uint16_t u16;
+        uint32_t u32;
+        uint64_t u64;
+        int8_t i8;
+        int16_t i16;
+        int32_t i32;
+        int64_t i64;
+        float f32;
+        double f64;
+        bool flag;
+        Channel channel;
+        const Sample *next;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Sample" );
+            mirror.Reflect( &Sample::u8, 0 );
+            mirror.Reflect( &Sample::u16, 1 );
+            mirror.Reflect( &Sample::u32, 2 );
+            mirror.Reflect( &Sample::u64, 3 );
+            mirror.Reflect( &Sample::i8, 4 );
+            mirror.Reflect( &Sample::i16, 5 );
+            mirror.Reflect( &Sample::i32, 6 );
+            mirror.Reflect( &Sample::i64, 7 );
+            mirror.Reflect( &Sample::f32, 8 );
+            mirror.Reflect( &Sample::f64, 9 );
+            mirror.Reflect( &Sample::flag, 10 );
+            mirror.Reflect( &Sample::channel, 11 );
+            mirror.Reflect( &Sample::next, 12 );
+        }
+    };
+
+    const uint64_t gLookupsPerThread = 4000000;
+
+    template< typename tLookup >
+    double RunThreads( uint32_t threadCount, tLookup lookup )
+    {
+        return Bench::Measure( gLookupsPerThread * threadCount, [threadCount, lookup]( uint64_t )
+        {
+            std::vector< std::thread > threads;
+
+            for ( uint32_t i = 0; i < threadCount; ++i )
+            {
+                threads.emplace_back( [lookup]()
+                {
+                    for ( uint64_t j = 0; j < gLookupsPerThread; j += 4 )
+                    {
+                        lookup();
+                    }
+                } );
+            }
+
+            for ( std::thread &thread : threads )
+            {
+                thread.join();
+            }
+        } );
+    }
+
+    void ReportScaling( const char *name, double nanoseconds, uint32_t threadCount )
+    {
+        char extra[64];
+        snprintf( extra, sizeof( extra ), "(%u threads, %.1f Mlookups/s)", threadCount, 1000.0 / nanoseconds );
+        Bench::Report( "Registry", name, nanoseconds, extra );
+    }
+}
+
+BENCHMARK( FrozenRegistryLookup )
+{
+    Reflect::GetType< LookupType< 0 > >();
+    Reflect::GetType< LookupType< 1 > >();
+    Reflect::GetType< LookupType< 2 > >();
+    Reflect::GetType< LookupType< 3 > >();
+
+    std::mutex globalLock;
+
+    const auto lockedLookup = [&globalLock]()
+    {
+        std::lock_guard< std::mutex > lock( globalLock );
+        Bench::DoNotOptimize( Reflect::GetType< LookupType< 0 > >() );
+        Bench::DoNotOptimize( Reflect::GetType< LookupType< 1 > >() );
+        Bench::DoNotOptimize( Reflect::GetType< LookupType< 2 > >() );
+        Bench::DoNotOptimize( Reflect::GetType( "LookupType3" ) );
+    };
+
+    const auto frozenLookup = []()
+    {
+        Bench::DoNotOptimize( Reflect::GetType< LookupType< 0 > >() );
+        Bench::DoNotOptimize( Reflect::GetType< LookupType< 1 > >() );
+        Bench::DoNotOptimize( Reflect::GetType< LookupType< 2 > >() );
+        Bench::DoNotOptimize( Reflect::GetType( "LookupType3" ) );
+    };
+
+    for ( uint32_t threadCount = 1; threadCount <= 32; threadCount *= 2 )
+    {
+        ReportScaling( "GetType (global mutex)", RunThreads( threadCount, lockedLookup ), threadCount );
+    }
+
+    Reflect::Freeze();
+
+    for ( uint32_t threadCount = 1; threadCount <= 32; threadCount *= 2 )
+    {
+        ReportScaling( "GetType (frozen)", RunThreads( threadCount, frozenLookup ), threadCount );
+    }
+
+    Reflect::ClearAll();
+}
+
+BENCHMARK( TypeLookupLatency )
+{
+    const uint64_t lookups = 50000000;
+
+    const size_t classIds[] =
+    {
+        InternalReflection::GetInstance()->GetClassID< LookupType< 0 > >(),
+        InternalReflection::GetInstance()->GetClassID< LookupType< 1 > >(),
+        InternalReflection::GetInstance()->GetClassID< LookupType< 2 > >(),
+        InternalReflection::GetInstance()->GetClassID< LookupType< 3 > >()
+    };
+
+    const ITypeDescription *types[] =
+    {
+        Reflect::GetType< LookupType< 0 > >(),
+        Reflect::GetType< LookupType< 1 > >(),
+        Reflect::GetType< LookupType< 2 > >(),
+        Reflect::GetType< LookupType< 3 > >()
+    };
+
+    // the previous storage of the registry
+    std::unordered_map< size_t, const ITypeDescription * > map;
+    TypeTable table;
+
+    for ( size_t i = 0; i < 4; ++i )
+    {
+        map[classIds[i]] = types[i];
+        *table.GetSlot( classIds[i] ) = const_cast< ITypeDescription * >( types[i] );
+    }
+
+    Bench::Report( "Registry", "unordered_map find", Bench::Measure( lookups, [&map, &classIds]( uint64_t n )
+    {
+        for ( uint64_t i = 0; i < n; ++i )
+        {
+            Bench::DoNotOptimize( map.find( classIds[i & 3] )->second );
+        }
+    } ) );
+
+    Bench::Report( "Registry", "TypeTable::Find", Bench::Measure( lookups, [&table, &classIds]( uint64_t n )
+    {
+        for ( uint64_t i = 0; i < n; ++i )
+        {
+            Bench::DoNotOptimize( table.Find( classIds[i & 3] ) );
+        }
+    } ) );
+
+    Bench::Report( "Registry", "GetType<T> (registering)", Bench::Measure( lookups, []( uint64_t n )
+    {
+        for ( uint64_t i = 0; i < n; ++i )
+        {
+            Bench::DoNotOptimize( Reflect::GetType< LookupType< 0 > >() );
+        }
+    } ) );
+
+    Reflect::Freeze();
+
+    Bench::Report( "Registry", "GetType<T> (frozen)", Bench::Measure( lookups, []( uint64_t n )
+    {
+        for ( uint64_t i = 0; i < n; ++i )
+        {
+            Bench::DoNotOptimize( Reflect::GetType< LookupType< 0 > >() );
+        }
+    } ) );
+
+    Reflect::ClearAll();
+}
+
+BENCHMARK( NameLookup )
+{
+    const uint32_t typeCount = 10000;
+    const uint64_t lookups = 20000000;
+
+    // the names as they arrive in a receive buffer
+    std::string buffer;
+    std::vector< std::string_view > slices;
+    std::vector< size_t > offsets;
+
+    for ( uint32_t i = 0; i < typeCount; ++i )
+    {
+        offsets.push_back( buffer.size() );
+        buffer += "Namespace::Module::RegisteredType" + std::to_string( i * 7919 );
+    }
+
+    offsets.push_back( buffer.size() );
+
+    for ( uint32_t i = 0; i < typeCount; ++i )
+    {
+        slices.emplace_back( buffer.data() + offsets[i], offsets[i + 1] - offsets[i] );
+    }
+
+    std::vector< ITypeDescription * > types;
+
+    for ( uint32_t i = 0; i < typeCount; ++i )
+    {
+        types.push_back( reinterpret_cast< ITypeDescription * >( static_cast< uintptr_t >( i + 1 ) * 64 ) );
+    }
+
+    // the previous lookup path: a std::string key, the name cache, then the type map
+    std::unordered_map< std::string, size_t > nameCache;
+    std::unordered_map< size_t, ITypeDescription * > typeMap;
+    std::unordered_map< std::string_view, size_t > viewCache;
+    std::vector< std::pair< std::string_view, ITypeDescription * > > entries;
+
+    for ( uint32_t i = 0; i < typeCount; ++i )
+    {
+        nameCache[std::string( slices[i] )] = i + 1;
+        viewCache[slices[i]] = i + 1;
+        typeMap[i + 1] = types[i];
+        entries.emplace_back( slices[i], types[i] );
+    }
+
+    NameIndex< ITypeDescription * > index;
+
+    const double buildTime = Bench::Measure( 1, [&index, &entries]( uint64_t )
+    {
+        index.Build( entries );
+    } );
+
+    // visit the names in a scattered order, like a real message stream would
+    const auto next = []( uint64_t i )
+    {
+        return static_cast< size_t >( ( i * 2654435761ULL ) % typeCount );
+    };
+
+    Bench::Report( "NameLookup", "std::string + 2x unordered_map", Bench::Measure( lookups, [&]( uint64_t n )
+    {
+        for ( uint64_t i = 0; i < n; ++i )
+        {
+            const auto nameIt = nameCache.find( std::string( slices[next( i )] ) );
+            Bench::DoNotOptimize( typeMap.find( nameIt->second )->second );
+        }
+    } ), "(10k types)" );
+
+    Bench::Report( "NameLookup", "string_view + unordered_map", Bench::Measure( lookups, [&]( uint64_t n )
+    {
+        for ( uint64_t i = 0; i < n; ++i )
+        {
+            Bench::DoNotOptimize( viewCache.find( slices[next( i )] )->second );
+        }
+    } ), "(10k types)" );
+
+    Bench::Report( "NameLookup", "NameIndex (perfect hash)", Bench::Measure( lookups, [&]( uint64_t n )
+    {
+        for ( uint64_t i = 0; i < n; ++i )
+        {
+            Bench::DoNotOptimize( *index.Find( slices[next( i )] ) );
+        }
+    } ), "(10k types)" );
+
+    Bench::Report( "NameLookup", "NameIndex build", buildTime, "(10k types)" );
+}
+
+BENCHMARK( Registration )
+{
+    // registers the class and its property types, and clears them all again
+    Bench::Report( "Registration", "13 primitive properties", Bench::Measure( 20000, []( uint64_t n )
+    {
+        for ( uint64_t i = 0; i < n; ++i )
+        {
+            Bench::DoNotOptimize( Reflect::GetType< Sample >() );
+            Reflect::ClearAll();
+        }
+    } ) );
+}
+
+namespace
+{
+    template< size_t... tN >
+    std::vector< const ITypeDescription * > RegisterLookupTypes( std::index_sequence< tN... > )
+    {
+        return { Reflect::GetType< LookupType< static_cast< uint32_t >( tN ) > >()... };
+    }
+}
+
+BENCHMARK( FlagQuery )
+{
+    const std::vector< const ITypeDescription * > types = RegisterLookupTypes( std::make_index_sequence< 512 >() );
+    const uint32_t flags = ITypeDescription::IsPOD | ITypeDescription::HasReflectedProperties;
+
+    Bench::Report( "FlagQuery", "GetFlags per type", Bench::Measure( 20000, [&types, flags]( uint64_t n )
+    {
+        for ( uint64_t i = 0; i < n; ++i )
+        {
+            std::vector< const ITypeDescription * > found;
+
+            for ( const ITypeDescription *type : types )
+            {
+                if ( type->HasFlags( flags ) )
+                {
+                    found.push_back( type );
+                }
+            }
+
+            Bench::DoNotOptimize( found.data() );
+        }
+    } ), "(512 types)" );
+
+    Bench::Report( "FlagQuery", "Reflect::FindTypes", Bench::Measure( 20000, [flags]( uint64_t n )
+    {
+        for ( uint64_t i = 0; i < n; ++i )
+        {
+            Bench::DoNotOptimize( Reflect::FindTypes( flags ).data() );
+        }
+    } ), "(512 types)" );
+
+    Bench::Report( "FlagQuery", "Reflect::FindTypes (none match)", Bench::Measure( 20000, []( uint64_t n )
+    {
+        for ( uint64_t i = 0; i < n; ++i )
+        {
+            Bench::DoNotOptimize( Reflect::FindTypes( ITypeDescription::IsPolymorphic ).data() );
+        }
+    } ), "(512 types)" );
+
+    Reflect::ClearAll();
+}
\ No newline at end of file
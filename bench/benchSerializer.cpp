@@ -0,0 +1,210 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/taggedSerializer.h"
+
+#include "bench.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    class Order
+    {
+    public:
+
+        uint64_t id;
+        uint32_t account;
+        uint32_t quantity;
+        double price;
+        double limit;
+        std::string symbol;
+        std::vector< double > fills;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Order" );
+            mirror.Reflect( &Order::id, 0, "id" );
+            mirror.Reflect( &Order::account, 1, "account" );
+            mirror.Reflect( &Order::quantity, 2, "quantity" );
+            mirror.Reflect( &Order::price, 3, "price" );
+            mirror.Reflect( &Order::limit, 4, "limit" );
+            mirror.Reflect( &Order::symbol, 5, "symbol" );
+            mirror.Reflect( &Order::fills, 6, "fills" );
+        }
+    };
+
+    void WriteByHand( const Order &order, BinaryWriter &writer )
+    {
+        writer.Write( &order.id, sizeof( order.id ) );
+        writer.Write( &order.account, sizeof( order.account ) );
+        writer.Write( &order.quantity, sizeof( order.quantity ) );
+        writer.Write( &order.price, sizeof( order.price ) );
+        writer.Write( &order.limit, sizeof( order.limit ) );
+        writer.WriteCount( order.symbol.size() );
+        writer.Write( order.symbol.data(), order.symbol.size() );
+        writer.WriteCount( order.fills.size() );
+        writer.Write( order.fills.data(), order.fills.size() * sizeof( double ) );
+    }
+
+    bool ReadByHand( Order &order, BinaryReader &reader )
+    {
+        size_t count;
+
+        if ( !reader.Read( &order.id, sizeof( order.id ) ) || !reader.Read( &order.account, sizeof( order.account ) ) ||
+             !reader.Read( &order.quantity, sizeof( order.quantity ) ) || !reader.Read( &order.price, sizeof( order.price ) ) ||
+             !reader.Read( &order.limit, sizeof( order.limit ) ) || !reader.ReadCount( count ) || count > reader.GetRemaining() )
+        {
+            return false;
+        }
+
+        order.symbol.resize( count );
+
+        if ( !reader.Read( &order.symbol[0], count ) || !reader.ReadCount( count ) ||
+             count * sizeof( double ) > reader.GetRemaining() )
+        {
+            return false;
+        }
+
+        order.fills.resize( count );
+        return reader.Read( order.fills.data(), count * sizeof( double ) );
+    }
+
+    const uint64_t gMessageCount = 2000000;
+}
+
+BENCHMARK( BinarySerializer )
+{
+    std::vector< Order > orders( 1024 );
+
+    for ( size_t i = 0; i < orders.size(); ++i )
+    {
+        orders[i] = { i, static_cast< uint32_t >( i * 7 ), 100, 1.25 * i, 2.5 * i, "SYM" + std::to_string( i % 10 ),
+                      std::vector< double >( i % 4, 0.5 ) };
+    }
+
+    const ITypeDescription *type = Reflect::GetType< Order >();
+    std::vector< uint8_t > buffer;
+    buffer.reserve( 1 << 16 );
+
+    const double byHand = Bench::Measure( gMessageCount, [&orders, &buffer]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            buffer.clear();
+            BinaryWriter writer( buffer );
+            WriteByHand( orders[i & 1023], writer );
+        }
+
+        Bench::DoNotOptimize( buffer.data() );
+    } );
+
+    const double reflected = Bench::Measure( gMessageCount, [&orders, &buffer, type]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            buffer.clear();
+            BinaryWriter writer( buffer );
+            Reflect::Serialize( type, &orders[i & 1023], writer );
+        }
+
+        Bench::DoNotOptimize( buffer.data() );
+    } );
+
+    char extra[64];
+    snprintf( extra, sizeof( extra ), "(%zu bytes)", buffer.size() );
+
+    Bench::Report( "BinarySerializer", "Serialize by hand", byHand, extra );
+    Bench::Report( "BinarySerializer", "Reflect::Serialize", reflected );
+
+    Order order;
+
+    const double readByHand = Bench::Measure( gMessageCount, [&buffer, &order]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            BinaryReader reader( buffer.data(), buffer.size() );
+            ReadByHand( order, reader );
+        }
+
+        Bench::DoNotOptimize( order );
+    } );
+
+    const double readReflected = Bench::Measure( gMessageCount, [&buffer, &order, type]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            BinaryReader reader( buffer.data(), buffer.size() );
+            Reflect::Deserialize( type, &order, reader );
+        }
+
+        Bench::DoNotOptimize( order );
+    } );
+
+    Bench::Report( "BinarySerializer", "Deserialize by hand", readByHand );
+    Bench::Report( "BinarySerializer", "Reflect::Deserialize", readReflected );
+}
+
+BENCHMARK( TaggedSerializer )
+{
+    Order order = { 42, 7, 100, 1.25, 2.5, "SYM4", { 0.5, 0.25 } };
+
+    const ITypeDescription *type = Reflect::GetType< Order >();
+    std::vector< uint8_t > buffer;
+    buffer.reserve( 1 << 16 );
+
+    const double serialize = Bench::Measure( gMessageCount, [&order, &buffer, type]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            buffer.clear();
+            BinaryWriter writer( buffer );
+            Reflect::SerializeTagged( type, &order, writer );
+        }
+
+        Bench::DoNotOptimize( buffer.data() );
+    } );
+
+    Order result;
+
+    const double deserialize = Bench::Measure( gMessageCount, [&buffer, &result, type]( uint64_t count )
+    {
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            BinaryReader reader( buffer.data(), buffer.size() );
+            Reflect::DeserializeTagged( type, &result, reader );
+        }
+
+        Bench::DoNotOptimize( result );
+    } );
+
+    char extra[64];
+    snprintf( extra, sizeof( extra ), "(%zu bytes)", buffer.size() );
+
+    Bench::Report( "TaggedSerializer", "Reflect::SerializeTagged", serialize, extra );
+    Bench::Report( "TaggedSerializer", "Reflect::DeserializeTagged", deserialize );
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/serializer.h"
+#include "reflection/view.h"
+
+#include "bench.h"
+
+#include <vector>
+
+namespace
+{
+    class Tick
+    {
+    public:
+
+        uint64_t time;
+        double price;
+        uint32_t volume;
+        uint32_t venue;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Tick" );
+            mirror.Reflect( &Tick::time, 0, "time" );
+            mirror.Reflect( &Tick::price, 1, "price" );
+            mirror.Reflect( &Tick::volume, 2, "volume" );
+            mirror.Reflect( &Tick::venue, 3, "venue" );
+        }
+    };
+
+    const size_t gTickCount = 4000000;
+}
+
+BENCHMARK( MappedView )
+{
+    std::vector< Tick > ticks( gTickCount );
+
+    for ( size_t i = 0; i < gTickCount; ++i )
+    {
+        ticks[i] = { i, 100.0 + ( i & 0xff ), static_cast< uint32_t >( i % 1000 ), 1 };
+    }
+
+    std::vector< uint8_t > viewBuffer;
+    Reflect::WriteView( ticks, viewBuffer );
+
+    std::vector< uint8_t > serialized;
+
+    for ( const Tick &tick : ticks )
+    {
+        Reflect::Serialize( tick, serialized );
+    }
+
+    const ITypeDescription *type = Reflect::GetType< Tick >();
+
+    const double deserialize = Bench::Measure( gTickCount, [&serialized, type]( uint64_t count )
+    {
+        std::vector< Tick > loaded( count );
+        BinaryReader reader( serialized.data(), serialized.size() );
+        double sum = 0.0;
+
+        for ( uint64_t i = 0; i < count; ++i )
+        {
+            Reflect::Deserialize( type, &loaded[i], reader );
+            sum += loaded[i].price;
+        }
+
+        Bench::DoNotOptimize( sum );
+    } );
+
+    const double view = Bench::Measure( gTickCount, [&viewBuffer]( uint64_t count )
+    {
+        const ObjectView< Tick > ticks = Reflect::View< Tick >( viewBuffer.data(), viewBuffer.size() );
+        double sum = 0.0;
+
+        for ( uint64_t i = 0; i < count && i < ticks.size(); ++i )
+        {
+            sum += ticks.Get( i, &Tick::price );
+        }
+
+        Bench::DoNotOptimize( sum );
+    } );
+
+    Bench::Report( "MappedView", "Deserialize then read (per record)", deserialize );
+    Bench::Report( "MappedView", "View in place (per record)", view );
+}
\ No newline at end of file
@@ -26,4 +26,22 @@ local zefiros = require( "Zefiros-Software/Zefiros-Defaults", "@head" )
 
 workspace "RefLib"
 
-	zefiros.setDefaults( "reflection" )
\ No newline at end of file
+	cppdialect "C++17"
+
+	zefiros.setDefaults( "reflection" )
+
+project "reflection-bench"
+
+	kind "ConsoleApp"
+
+	files {
+		"bench/**.h",
+		"bench/**.cpp"
+		}
+
+	includedirs {
+		"reflection/include/",
+		"bench/"
+		}
+
+	links "reflection"
@@ -28,7 +28,13 @@
 #ifndef __REFLECTION_ITYPEDESCRIPTION_H__
 #define __REFLECTION_ITYPEDESCRIPTION_H__
 
+#include "reflection/util.h"
+#include "reflection/plan.h"
+
 #include <stdint.h>
+#include <stddef.h>
+#include <type_traits>
+#include <atomic>
 #include <string>
 
 class AbstractProperties;
@@ -36,6 +42,7 @@ class AbstractProperties;
 class ITypeDescription
 {
     friend class Mirror;
+    friend class InternalReflection;
 public:
 
     enum Type
@@ -65,11 +72,33 @@ public:
         IsStandardLayout        = ( 1 << 22 ),
         IsTrivial               = ( 1 << 23 ),
         IsUnsigned              = ( 1 << 24 ),
-        IsVolatile              = ( 1 << 25 )
+        IsVolatile              = ( 1 << 25 ),
+
+        // Not a trait of the type itself, but set once a class with reflected properties is registered
+        HasReflectedProperties  = ( 1 << 26 ),
+
+        FlagCount               = 27
+    };
+
+    struct BaseClass
+    {
+        // The registered description of the base class
+        const ITypeDescription *type;
+
+        // The byte offset of the base class subobject within the derived object
+        ptrdiff_t offset;
+
+        int32_t index;
     };
 
+    ITypeDescription()
+        : mPlan( nullptr )
+    {
+    }
+
     virtual ~ITypeDescription()
     {
+        delete mPlan.load();
     }
 
     virtual bool IsBaseClass() const = 0;
@@ -84,12 +113,85 @@ public:
 
     virtual const char *GetCDescription() const = 0;
 
+    virtual uint64_t GetTypeID() const = 0;
+
+    // The Type flags of the type
+    virtual uint32_t GetFlags() const = 0;
+
+    bool HasFlags( uint32_t flags ) const
+    {
+        return ( GetFlags() & flags ) == flags;
+    }
+
     virtual const AbstractProperties *GetProperties() const = 0;
 
+    // How values of the type itself are constructed, copied and destroyed
+    virtual const ValueType &GetValueType() const = 0;
+
+    // The direct base classes
+    virtual ArrayView< BaseClass > GetBaseClasses() const = 0;
+
+    // The direct base classes followed by all their ancestors, with offsets relative to this type
+    virtual ArrayView< BaseClass > GetAncestors() const = 0;
+
+    // The compiled plan of the properties, which is built once at first use and shared by all its consumers
+    const TypePlan &GetPlan() const
+    {
+        const TypePlan *plan = mPlan.load( std::memory_order_acquire );
+
+        return plan ? *plan : BuildPlan();
+    }
+
 protected:
 
     virtual void Declare( const char *name, const char *description ) = 0;
 
+    virtual void DeclareTypeID( uint64_t typeId ) = 0;
+
+    // Called once the type is reflected, to build everything that can be precomputed for it
+    virtual void Finalize() = 0;
+
+private:
+
+    mutable std::atomic< const TypePlan * > mPlan;
+
+    const TypePlan &BuildPlan() const;
+
 };
 
+namespace ReflectionHelper
+{
+    // The traits of a type as ITypeDescription::Type flags
+    template< typename tT >
+    constexpr uint32_t GetTypeFlags()
+    {
+        return ( std::is_array< tT >::value ? ITypeDescription::IsArray : 0x00 ) |
+               ( std::is_class< tT >::value ? ITypeDescription::IsClass : 0x00 ) |
+               ( std::is_enum< tT >::value ? ITypeDescription::IsEnum : 0x00 ) |
+               ( std::is_floating_point< tT >::value ? ITypeDescription::IsFloatingPoint : 0x00 ) |
+               ( std::is_integral< tT >::value ? ITypeDescription::IsIntegral : 0x00 ) |
+               ( std::is_member_function_pointer< tT >::value ? ITypeDescription::IsMemberFunctionPointer : 0x00 ) |
+               ( std::is_member_object_pointer< tT >::value ? ITypeDescription::IsMemberObjectPointer : 0x00 ) |
+               ( std::is_pointer< tT >::value ? ITypeDescription::IsPointer : 0x00 ) |
+               ( std::is_union< tT >::value ? ITypeDescription::IsUnion : 0x00 ) |
+               ( std::is_arithmetic< tT >::value ? ITypeDescription::IsArithmetic : 0x00 ) |
+               ( std::is_compound< tT >::value ? ITypeDescription::IsCompound : 0x00 ) |
+               ( std::is_fundamental< tT >::value ? ITypeDescription::IsFundamental : 0x00 ) |
+               ( std::is_member_pointer< tT >::value ? ITypeDescription::IsMemberPointer : 0x00 ) |
+               ( std::is_object< tT >::value ? ITypeDescription::IsObject : 0x00 ) |
+               ( std::is_reference< tT >::value ? ITypeDescription::IsReference : 0x00 ) |
+               ( std::is_scalar< tT >::value ? ITypeDescription::IsScalar : 0x00 ) |
+               ( std::is_const< tT >::value ? ITypeDescription::IsConst : 0x00 ) |
+               ( std::is_empty< tT >::value ? ITypeDescription::IsEmpty : 0x00 ) |
+               ( std::is_literal_type< tT >::value ? ITypeDescription::IsLiteral : 0x00 ) |
+               ( std::is_pod< tT >::value ? ITypeDescription::IsPOD : 0x00 ) |
+               ( std::is_polymorphic< tT >::value ? ITypeDescription::IsPolymorphic : 0x00 ) |
+               ( std::is_signed< tT >::value ? ITypeDescription::IsSigned : 0x00 ) |
+               ( std::is_standard_layout< tT >::value ? ITypeDescription::IsStandardLayout : 0x00 ) |
+               ( std::is_trivial< tT >::value ? ITypeDescription::IsTrivial : 0x00 ) |
+               ( std::is_unsigned< tT >::value ? ITypeDescription::IsUnsigned : 0x00 ) |
+               ( std::is_volatile< tT >::value ? ITypeDescription::IsVolatile : 0x00 );
+    }
+}
+
 #endif
\ No newline at end of file
@@ -28,14 +28,26 @@
 #ifndef __REFLECTION_ABSTRACTPROPERTY_H__
 #define __REFLECTION_ABSTRACTPROPERTY_H__
 
+#include "reflection/valueType.h"
+#include "reflection/gather.h"
+#include "reflection/typeId.h"
+
 #include "reflection/accessibility.h"
 
 #include <typeindex>
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+#include <memory>
 #include <string>
+#include <vector>
 
 class AbstractProperty
 {
+    template< class tClass >
+    friend class Properties;
+
 public:
 
     virtual ~AbstractProperty()
@@ -58,6 +70,28 @@ public:
 
     virtual Accessibility GetAccessibility() const = 0;
 
+    virtual uint32_t GetCustomFlags() const = 0;
+
+    bool HasCustomFlags( uint32_t flags ) const
+    {
+        return ( GetCustomFlags() & flags ) == flags;
+    }
+
+    // The value of the type attached to the property with Mirror::Attribute, or nullptr
+    template< typename tAttribute >
+    const tAttribute *GetAttribute() const
+    {
+        for ( const Attribute &attribute : mAttributes )
+        {
+            if ( attribute.type == ReflectionHelper::TypeID< tAttribute >::value )
+            {
+                return static_cast< const tAttribute * >( attribute.value.get() );
+            }
+        }
+
+        return nullptr;
+    }
+
     template< typename tClass, typename tProperty >
     void Set( tClass &object, const tProperty &propert )
     {
@@ -72,6 +106,152 @@ public:
 
     virtual void Set( void *obj, void *val ) = 0;
     virtual void *Get( void *obj ) const = 0;
+
+    // Whether the value is found at a fixed byte offset in every object, which holds for standard layout classes
+    bool HasOffset() const
+    {
+        return ( mLayoutFlags & LayoutFlags::HasOffset ) != 0;
+    }
+
+    bool IsTriviallyCopyable() const
+    {
+        return ( mLayoutFlags & LayoutFlags::IsTriviallyCopyable ) != 0;
+    }
+
+    uint32_t GetOffset() const
+    {
+        assert( HasOffset() );
+        return mOffset;
+    }
+
+    uint32_t GetSize() const
+    {
+        return mSize;
+    }
+
+    const ValueType &GetValueType() const
+    {
+        assert( mValueType );
+        return *mValueType;
+    }
+
+    void *GetAddress( void *object ) const
+    {
+        assert( HasOffset() );
+        return static_cast< uint8_t * >( object ) + mOffset;
+    }
+
+    const void *GetAddress( const void *object ) const
+    {
+        assert( HasOffset() );
+        return static_cast< const uint8_t * >( object ) + mOffset;
+    }
+
+    // Non virtual access through the byte offset
+    template< typename tProperty >
+    tProperty &At( void *object ) const
+    {
+        assert( sizeof( tProperty ) == mSize );
+        return *static_cast< tProperty * >( GetAddress( object ) );
+    }
+
+    template< typename tProperty >
+    const tProperty &At( const void *object ) const
+    {
+        assert( sizeof( tProperty ) == mSize );
+        return *static_cast< const tProperty * >( GetAddress( object ) );
+    }
+
+    // Copies the value between two objects without an indirect call
+    void CopyValue( void *destination, const void *source ) const
+    {
+        assert( IsTriviallyCopyable() );
+        memcpy( GetAddress( destination ), GetAddress( source ), mSize );
+    }
+
+    // Copies the values of count objects, stride bytes apart, into output, which holds count values of the property
+    void Gather( const void *objects, size_t stride, size_t count, void *output ) const
+    {
+        assert( stride >= mSize );
+
+        if ( HasOffset() && IsTriviallyCopyable() )
+        {
+            ReflectionHelper::GatherStrided( static_cast< const uint8_t * >( objects ) + mOffset, stride, count, mSize,
+                                             output );
+        }
+        else
+        {
+            GatherValues( objects, stride, count, output );
+        }
+    }
+
+    // Assigns count contiguous values from input to the property of count objects, stride bytes apart
+    void Scatter( const void *input, void *objects, size_t stride, size_t count ) const
+    {
+        assert( stride >= mSize );
+
+        if ( HasOffset() && IsTriviallyCopyable() )
+        {
+            ReflectionHelper::ScatterStrided( input, count, mSize, static_cast< uint8_t * >( objects ) + mOffset, stride );
+        }
+        else
+        {
+            ScatterValues( input, objects, stride, count );
+        }
+    }
+
+protected:
+
+    struct LayoutFlags
+    {
+        enum
+        {
+            HasOffset           = 0x01,
+            IsTriviallyCopyable = 0x02
+        };
+    };
+
+    struct Attribute
+    {
+        uint64_t type;
+
+        // Shared by the copies of the property in derived classes
+        std::shared_ptr< const void > value;
+    };
+
+    const ValueType *mValueType;
+    uint32_t mOffset;
+    uint32_t mSize;
+    uint32_t mLayoutFlags;
+    std::vector< Attribute > mAttributes;
+
+    AbstractProperty()
+        : mValueType( nullptr ),
+          mOffset( 0 ),
+          mSize( 0 ),
+          mLayoutFlags( 0 )
+    {
+    }
+
+    AbstractProperty( const ValueType &valueType, uint32_t offset, uint32_t layoutFlags )
+        : mValueType( &valueType ),
+          mOffset( offset ),
+          mSize( static_cast< uint32_t >( valueType.size ) ),
+          mLayoutFlags( layoutFlags )
+    {
+    }
+
+    AbstractProperty( const AbstractProperty & ) = default;
+
+    virtual size_t GetStorageSize() const = 0;
+
+    virtual void GatherValues( const void *objects, size_t stride, size_t count, void *output ) const = 0;
+
+    virtual void ScatterValues( const void *input, void *objects, size_t stride, size_t count ) const = 0;
+
+    // Copy constructs the property into storage of at least GetStorageSize() bytes, the base offset is added to
+    // the offset of the copy so it accesses the property through an object that derives from the owner
+    virtual AbstractProperty *CloneInto( void *storage, ptrdiff_t baseOffset ) const = 0;
 };
 
 #endif
\ No newline at end of file
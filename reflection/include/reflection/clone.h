@@ -0,0 +1,81 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_CLONE_H__
+#define __REFLECTION_CLONE_H__
+
+#include "reflection/reflection.h"
+
+#include <stddef.h>
+
+/**
+ * Copying of objects driven by the plan of their type. Merged trivially copyable runs are copied with a single
+ * memcpy, and only strings, containers and properties behind accessors go through their copy assignment. Nested
+ * classes at a fixed offset are copied through their own properties, while pointers are copied as addresses, so the
+ * objects they point to are shared rather than cloned. Members that are not reflected keep their value, except for
+ * trivially copyable classes, which are always copied whole.
+ */
+namespace Reflect
+{
+    // Assigns the reflected properties of the source to an existing object
+    void CopyInto( const ITypeDescription *type, void *destination, const void *source );
+
+    // Assigns the reflected properties of count consecutive source objects to count existing objects
+    void CopyInto( const ITypeDescription *type, void *destinations, const void *sources, size_t count );
+
+    // Clones count consecutive objects into uninitialised storage, which the caller destroys. The type has to be
+    // default constructible, unless it is trivially copyable
+    bool CloneInto( const ITypeDescription *type, void *storage, const void *sources, size_t count );
+
+    template< class tClass >
+    inline void CopyInto( tClass &destination, const tClass &source )
+    {
+        CopyInto( GetType< tClass >(), &destination, &source );
+    }
+
+    template< class tClass >
+    inline void CopyInto( tClass *destinations, const tClass *sources, size_t count )
+    {
+        CopyInto( GetType< tClass >(), destinations, sources, count );
+    }
+
+    template< class tClass >
+    inline bool CloneInto( tClass *storage, const tClass *sources, size_t count )
+    {
+        return CloneInto( GetType< tClass >(), storage, sources, count );
+    }
+
+    template< class tClass >
+    inline tClass Clone( const tClass &source )
+    {
+        tClass clone;
+        CopyInto( GetType< tClass >(), &clone, &source );
+        return clone;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,103 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_COMPARE_H__
+#define __REFLECTION_COMPARE_H__
+
+#include "reflection/reflection.h"
+#include "reflection/hash.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Hashing and equality driven by the reflected properties, over the plan of the type. Merged trivially copyable runs
+ * are hashed and compared as blocks of bytes, so the padding between properties never takes part, and nested
+ * classes are followed through their own properties. Trivially copyable values compare by their bytes, so 0.0 and
+ * -0.0 differ, and pointers compare by address. Properties with any of the excluded custom flags are left out.
+ */
+namespace Reflect
+{
+    uint64_t Hash( const ITypeDescription *type, const void *object, uint32_t excludeFlags = 0 );
+
+    bool Equal( const ITypeDescription *type, const void *left, const void *right, uint32_t excludeFlags = 0 );
+
+    template< class tClass >
+    inline uint64_t Hash( const tClass &object, uint32_t excludeFlags = 0 )
+    {
+        return Hash( GetType< tClass >(), &object, excludeFlags );
+    }
+
+    template< class tClass >
+    inline bool Equal( const tClass &left, const tClass &right, uint32_t excludeFlags = 0 )
+    {
+        return Equal( GetType< tClass >(), &left, &right, excludeFlags );
+    }
+
+    // A hash functor for unordered containers, which looks the type up once
+    template< class tClass, uint32_t tExcludeFlags = 0 >
+    class Hasher
+    {
+    public:
+
+        Hasher()
+            : mType( GetType< tClass >() )
+        {
+        }
+
+        size_t operator()( const tClass &object ) const
+        {
+            return static_cast< size_t >( Hash( mType, &object, tExcludeFlags ) );
+        }
+
+    private:
+
+        const ITypeDescription *mType;
+    };
+
+    template< class tClass, uint32_t tExcludeFlags = 0 >
+    class EqualTo
+    {
+    public:
+
+        EqualTo()
+            : mType( GetType< tClass >() )
+        {
+        }
+
+        bool operator()( const tClass &left, const tClass &right ) const
+        {
+            return Equal( mType, &left, &right, tExcludeFlags );
+        }
+
+    private:
+
+        const ITypeDescription *mType;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -32,4 +32,15 @@
 #   define REFLECTION_MAX_MEMBER_PTR_SIZE 20
 #endif
 
+// Property indices below this bound are looked up in a dense table, larger indices use a binary search
+#ifndef REFLECTION_MAX_DENSE_INDEX
+#   define REFLECTION_MAX_DENSE_INDEX 1024
+#endif
+
+#if defined( _MSC_VER )
+#   define REFLECTION_FUNCTION_SIGNATURE __FUNCSIG__
+#else
+#   define REFLECTION_FUNCTION_SIGNATURE __PRETTY_FUNCTION__
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,71 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_DELTA_H__
+#define __REFLECTION_DELTA_H__
+
+#include "reflection/serializer.h"
+
+/**
+ * A delta between two objects of the same type, made of a bitmask with a bit for every property of the type, in
+ * the order of AbstractProperties::GetView, followed by the changed properties in the binary format. Adjacent
+ * trivially copyable properties are compared as one block first, so the common case of a few changed fields costs
+ * a handful of memcmp calls. Both sides should use the same version of the type.
+ */
+namespace Reflect
+{
+    // Writes the properties of current that differ from baseline, and returns whether any did
+    bool WriteDelta( const ITypeDescription *type, const void *baseline, const void *current, BinaryWriter &writer );
+
+    // Patches the changed properties of the delta into the target
+    bool ApplyDelta( const ITypeDescription *type, void *target, BinaryReader &reader );
+
+    // Whether two values hold the same data, as far as the binary format writes it
+    bool ValuesEqual( const ValueType &type, const void *left, const void *right );
+
+    template< class tClass >
+    inline bool WriteDelta( const tClass &baseline, const tClass &current, std::vector< uint8_t > &buffer )
+    {
+        BinaryWriter writer( buffer );
+        return WriteDelta( GetType< tClass >(), &baseline, &current, writer );
+    }
+
+    template< class tClass >
+    inline bool ApplyDelta( tClass &target, const uint8_t *data, size_t size )
+    {
+        BinaryReader reader( data, size );
+        return ApplyDelta( GetType< tClass >(), &target, reader );
+    }
+
+    template< class tClass >
+    inline bool ApplyDelta( tClass &target, const std::vector< uint8_t > &buffer )
+    {
+        return ApplyDelta( target, buffer.data(), buffer.size() );
+    }
+}
+
+#endif
\ No newline at end of file
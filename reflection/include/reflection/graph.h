@@ -0,0 +1,146 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_GRAPH_H__
+#define __REFLECTION_GRAPH_H__
+
+#include "reflection/serializer.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <memory>
+#include <vector>
+
+// Maps the addresses of objects to their identifiers, with open addressing and linear probing
+class ObjectTable
+{
+public:
+
+    ObjectTable();
+
+    // Returns the identifier of the object, after giving it the identifier when it was not in the table yet
+    uint32_t Insert( const void *object, uint32_t id );
+
+    const uint32_t *Find( const void *object ) const;
+
+    void Clear();
+
+    size_t GetSize() const
+    {
+        return mSize;
+    }
+
+private:
+
+    struct Slot
+    {
+        const void *object;
+        uint32_t id;
+    };
+
+    std::vector< Slot > mSlots;
+    size_t mSize;
+    uint32_t mShift;
+
+    size_t GetSlot( const void *object ) const;
+
+    void Grow();
+};
+
+// Creates objects in large blocks, and destroys them all at once
+class ObjectArena
+{
+public:
+
+    explicit ObjectArena( size_t blockSize = 64 * 1024 );
+
+    ~ObjectArena();
+
+    ObjectArena( const ObjectArena & ) = delete;
+    ObjectArena &operator=( const ObjectArena & ) = delete;
+
+    // Default constructs an object of the type, or returns null when the type is not default constructible
+    void *Create( const ITypeDescription *type );
+
+    // Destroys the objects in the reverse order of their creation, keeping the first block for reuse
+    void Clear();
+
+private:
+
+    struct Destructor
+    {
+        void ( *destroy )( void *values, size_t count );
+        void *object;
+    };
+
+    std::vector< std::unique_ptr< uint8_t[] > > mBlocks;
+    std::vector< Destructor > mDestructors;
+    uint8_t *mCursor;
+    uint8_t *mEnd;
+    size_t mBlockSize;
+
+    void *Allocate( size_t size, size_t alignment );
+};
+
+/**
+ * Writes a graph of reflected objects in the binary format, following the pointers to reflected classes. Every
+ * object reachable from the root is written once, in the order it is first met, and pointers are written as a
+ * variable length identifier: zero for null, one for the root, and one more than the last identifier for an object
+ * that was not met before. Reading gives the objects their identifiers in the same order, so shared objects and
+ * cycles are restored as they were. Objects are written as the type of the pointer, so an object cannot be reached
+ * through pointers of different types, and pointers to other types are written as null and left alone on reading.
+ */
+namespace Reflect
+{
+    // Fails when an object is reached through pointers of different types
+    bool WriteGraph( const ITypeDescription *type, const void *root, BinaryWriter &writer );
+
+    // Reads into an existing root, creating the other objects in the arena, which has to outlive the root
+    bool ReadGraph( const ITypeDescription *type, void *root, BinaryReader &reader, ObjectArena &arena );
+
+    template< class tClass >
+    inline bool WriteGraph( const tClass &root, std::vector< uint8_t > &buffer )
+    {
+        BinaryWriter writer( buffer );
+        return WriteGraph( GetType< tClass >(), &root, writer );
+    }
+
+    template< class tClass >
+    inline bool ReadGraph( const uint8_t *data, size_t size, tClass &root, ObjectArena &arena )
+    {
+        BinaryReader reader( data, size );
+        return ReadGraph( GetType< tClass >(), &root, reader, arena );
+    }
+
+    template< class tClass >
+    inline bool ReadGraph( const std::vector< uint8_t > &buffer, tClass &root, ObjectArena &arena )
+    {
+        return ReadGraph( buffer.data(), buffer.size(), root, arena );
+    }
+}
+
+#endif
\ No newline at end of file
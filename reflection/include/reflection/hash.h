@@ -0,0 +1,86 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_HASH_H__
+#define __REFLECTION_HASH_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace ReflectionHelper
+{
+    inline uint64_t RotateLeft( uint64_t value, uint32_t shift )
+    {
+        return ( value << shift ) | ( value >> ( 64 - shift ) );
+    }
+
+    // The murmur3 finaliser, every input bit affects every output bit
+    inline uint64_t MixHash( uint64_t hash )
+    {
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    inline uint64_t HashBytes( const void *data, size_t size, uint64_t seed = 0 )
+    {
+        const uint8_t *bytes = static_cast< const uint8_t * >( data );
+        uint64_t hash = seed ^ ( size * 0x9e3779b97f4a7c15ULL );
+
+        for ( ; size >= 8; size -= 8, bytes += 8 )
+        {
+            uint64_t block;
+            memcpy( &block, bytes, 8 );
+
+            hash ^= RotateLeft( block * 0x87c37b91114253d5ULL, 31 ) * 0x4cf5ad432745937fULL;
+            hash = RotateLeft( hash, 27 ) * 5 + 0x52dce729;
+        }
+
+        if ( size > 0 )
+        {
+            uint64_t block = 0;
+            memcpy( &block, bytes, size );
+
+            hash ^= RotateLeft( block * 0x87c37b91114253d5ULL, 31 ) * 0x4cf5ad432745937fULL;
+        }
+
+        return MixHash( hash );
+    }
+
+    // A hash for longer inputs, which mixes 32 byte blocks in four independent lanes and uses SIMD where available.
+    // It returns the same values on every instruction set, and falls back to HashBytes for short inputs.
+    uint64_t HashBlocks( const void *data, size_t size, uint64_t seed = 0 );
+
+    // The portable version of HashBlocks, which it matches bit for bit
+    uint64_t HashBlocksScalar( const void *data, size_t size, uint64_t seed = 0 );
+}
+
+#endif
\ No newline at end of file
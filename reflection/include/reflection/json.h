@@ -0,0 +1,246 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_JSON_H__
+#define __REFLECTION_JSON_H__
+
+#include "reflection/reflection.h"
+
+#include <string_view>
+#include <string>
+#include <stdint.h>
+#include <stddef.h>
+
+// Appends JSON text to a reusable buffer, inserting the separators between values itself
+class JsonWriter
+{
+public:
+
+    explicit JsonWriter( std::string &buffer )
+        : mBuffer( buffer ),
+          mSeparate( false )
+    {
+    }
+
+    void BeginObject()
+    {
+        Separate();
+        mBuffer.push_back( '{' );
+        mSeparate = false;
+    }
+
+    void EndObject()
+    {
+        mBuffer.push_back( '}' );
+        mSeparate = true;
+    }
+
+    void BeginArray()
+    {
+        Separate();
+        mBuffer.push_back( '[' );
+        mSeparate = false;
+    }
+
+    void EndArray()
+    {
+        mBuffer.push_back( ']' );
+        mSeparate = true;
+    }
+
+    // Writes the name of the next member of an object
+    void Key( std::string_view name );
+
+    void String( std::string_view value );
+    void Int( int64_t value );
+    void UInt( uint64_t value );
+
+    // Write the shortest text that reads back to the same value, or null for NaN and infinities
+    void Float( float value );
+    void Double( double value );
+
+    void Bool( bool value )
+    {
+        Separate();
+        mBuffer.append( value ? "true" : "false" );
+        mSeparate = true;
+    }
+
+    void Null()
+    {
+        Separate();
+        mBuffer.append( "null" );
+        mSeparate = true;
+    }
+
+    std::string &GetBuffer()
+    {
+        return mBuffer;
+    }
+
+private:
+
+    std::string &mBuffer;
+    bool mSeparate;
+
+    void Separate()
+    {
+        if ( mSeparate )
+        {
+            mBuffer.push_back( ',' );
+        }
+    }
+};
+
+enum class JsonToken : uint8_t
+{
+    BeginObject,
+    EndObject,
+    BeginArray,
+    EndArray,
+    Key,
+    String,
+    Number,
+    True,
+    False,
+    Null,
+    End,
+    Error
+};
+
+/**
+ * A pull parser over a JSON document, returning one token per call. Keys and strings without escapes are
+ * returned as views into the document, so the document should outlive the strings read from it. Once an error
+ * is found every following call returns JsonToken::Error.
+ */
+class JsonReader
+{
+public:
+
+    explicit JsonReader( std::string_view text );
+
+    JsonToken Next();
+
+    // Skips the value that follows, including everything nested inside it
+    bool SkipValue();
+
+    // The decoded text of the last key or string
+    std::string_view GetString() const
+    {
+        return mString;
+    }
+
+    // The last number, converted to the requested type
+    bool GetInt( int64_t &value ) const;
+    bool GetUInt( uint64_t &value ) const;
+    bool GetDouble( double &value ) const;
+
+    bool HasError() const
+    {
+        return mState == State::Error;
+    }
+
+    size_t GetPosition() const
+    {
+        return static_cast< size_t >( mCursor - mBegin );
+    }
+
+private:
+
+    enum class State : uint8_t
+    {
+        Value,
+        ValueOrEnd,
+        Key,
+        KeyOrEnd,
+        AfterValue,
+        Error
+    };
+
+    const char *mBegin;
+    const char *mCursor;
+    const char *mEnd;
+
+    State mState;
+
+    // The open objects and arrays, as '{' and '[', held inline for shallow documents
+    std::string mStack;
+
+    std::string_view mString;
+    std::string_view mNumber;
+
+    // Holds strings whose escapes were decoded
+    std::string mScratch;
+
+    JsonToken ReadValue();
+    JsonToken Close( char bracket );
+    JsonToken Fail();
+
+    bool ReadString();
+    bool ReadEscape();
+    bool ReadLiteral( const char *literal, size_t size );
+    void SkipWhitespace();
+};
+
+namespace ReflectionHelper
+{
+    // The first quote, backslash or control character at or after the cursor, or the end
+    const char *FindStringSpecial( const char *cursor, const char *end );
+
+    // The first bracket, brace or quote at or after the cursor, or the end
+    const char *FindStructural( const char *cursor, const char *end );
+}
+
+/**
+ * Reads and writes reflected objects as JSON objects keyed by the property names. Numbers, booleans, strings,
+ * sequences and reflected classes are supported, pointers are left out. Members with unknown names are skipped
+ * when reading, and members that are missing keep their value.
+ */
+namespace Reflect
+{
+    void WriteJson( const ITypeDescription *type, const void *object, JsonWriter &writer );
+
+    // Reads one object into an existing object
+    bool ReadJson( const ITypeDescription *type, void *object, JsonReader &reader );
+
+    template< class tClass >
+    inline void WriteJson( const tClass &object, std::string &buffer )
+    {
+        JsonWriter writer( buffer );
+        WriteJson( GetType< tClass >(), &object, writer );
+    }
+
+    // Reads a document holding exactly one object
+    template< class tClass >
+    inline bool ReadJson( std::string_view text, tClass &object )
+    {
+        JsonReader reader( text );
+        return ReadJson( GetType< tClass >(), &object, reader ) && reader.Next() == JsonToken::End;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -30,7 +30,11 @@
 
 #include "reflection/typeDescription.h"
 
-#include "reflection/reflect.h"
+namespace Reflect
+{
+    template< class tClass >
+    const TypeDescription< tClass > *GetType();
+}
 
 class Mirror
 {
@@ -47,6 +51,18 @@ public:
         mTypeDescription->Declare( name, description );
     }
 
+    // Declares a stable type ID that replaces the type name hash. The hash depends on how the compiler spells the
+    // type name, so every type ID that gets persisted has to be declared this way.
+    void Reflect( const char *name,
+                  uint64_t typeId,
+                  const char *description = nullptr )
+    {
+        assert( typeId != 0 && "A type ID of 0 is not allowed." );
+
+        mTypeDescription->Declare( name, description );
+        mTypeDescription->DeclareTypeID( typeId );
+    }
+
 
 
     template< class tClass, class tProperty >
@@ -75,14 +91,14 @@ public:
     }
 
     template< class tClass, class tProperty >
-    void Reflect( size_t tClass::*variable,
+    void Reflect( tProperty tClass::*variable,
                   uint32_t index,
                   Accessibility accessibility,
-                  uint32_t customFlags = 0x00,
+                  uint32_t customFlags,
                   const char *name = nullptr,
                   const char *description = nullptr )
     {
-        GetTypeDescription< tClass >().GetProperties().Add( variable, accessibility, index, customFlags, name, description );
+        GetTypeDescription< tClass >().GetProperties()->Add( variable, accessibility, index, customFlags, name, description );
 
         // Reflect the property type as well
         Reflect::GetType< tProperty >();
@@ -96,7 +112,7 @@ public:
                   const char *name = nullptr,
                   const char *description = nullptr )
     {
-        GetTypeDescription< tClass >().GetProperties().Add( variable, accessibility, index, customFlags, name, description );
+        GetTypeDescription< tClass >().GetProperties()->Add( variable, accessibility, index, customFlags, name, description );
 
         // Reflect the property type as well
         Reflect::GetType< tProperty >();
@@ -109,8 +125,8 @@ public:
                   const char *name = nullptr,
                   const char *description = nullptr )
     {
-        GetTypeDescription< tClass >().GetProperties().Add( variable, Accessibility::Public, index, customFlags, name,
-                                                            description );
+        GetTypeDescription< tClass >().GetProperties()->Add( variable, Accessibility::Public, index, customFlags, name,
+                                                             description );
 
         // Reflect the property type as well
         Reflect::GetType< tProperty >();
@@ -122,10 +138,18 @@ public:
 
 
 
+    // Attaches a typed value to a reflected property, which is found again through GetAttribute< tAttribute >()
+    template< class tClass, class tProperty, class tAttribute >
+    void Attribute( tProperty tClass::*variable,
+                    tAttribute &&attribute )
+    {
+        GetTypeDescription< tClass >().GetProperties()->AddAttribute( variable, std::forward< tAttribute >( attribute ) );
+    }
+
     template< class tClass, class tBase >
     void Reflect( uint32_t baseClassIndex )
     {
-        GetTypeDescription< tClass >().AddBaseClass< tBase >( baseClassIndex );
+        GetTypeDescription< tClass >().template AddBaseClass< tBase >( Reflect::GetType< tBase >(), baseClassIndex );
     }
 
 private:
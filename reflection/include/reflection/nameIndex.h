@@ -0,0 +1,219 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_NAMEINDEX_H__
+#define __REFLECTION_NAMEINDEX_H__
+
+#include "reflection/hash.h"
+
+#include <string_view>
+#include <algorithm>
+#include <assert.h>
+#include <utility>
+#include <vector>
+
+/**
+ * An immutable minimal perfect hash over a set of unique names. Every name maps to its own entry, so a lookup
+ * hashes the name once, reads the displacement seed of its bucket and compares against exactly one entry.
+ * The names are not copied and should outlive the index.
+ */
+template< class tValue >
+class NameIndex
+{
+public:
+
+    NameIndex()
+    {
+    }
+
+    void Build( const std::vector< std::pair< std::string_view, tValue > > &entries )
+    {
+        Clear();
+
+        if ( entries.empty() )
+        {
+            return;
+        }
+
+        std::vector< uint64_t > hashes;
+        hashes.reserve( entries.size() );
+
+        for ( const auto &entry : entries )
+        {
+            hashes.push_back( ReflectionHelper::HashBytes( entry.first.data(), entry.first.size() ) );
+        }
+
+        // an average of four names per bucket keeps the seeds small while the displacement search stays fast
+        size_t bucketCount = entries.size() / 4 + 1;
+
+        while ( !TryBuild( entries, hashes, bucketCount ) )
+        {
+            // only names with equal hashes cannot be separated by any number of buckets
+            if ( bucketCount > entries.size() * 16 )
+            {
+                assert( false && "The names of a name index should be unique." );
+                Clear();
+                return;
+            }
+
+            bucketCount *= 2;
+        }
+    }
+
+    void Clear()
+    {
+        mSeeds.clear();
+        mEntries.clear();
+    }
+
+    size_t GetSize() const
+    {
+        return mEntries.size();
+    }
+
+    // Returns the value of the name, or nullptr when the name is not indexed
+    const tValue *Find( std::string_view name ) const
+    {
+        if ( mEntries.empty() )
+        {
+            return nullptr;
+        }
+
+        const uint64_t hash = ReflectionHelper::HashBytes( name.data(), name.size() );
+        const Entry &entry = mEntries[GetPosition( hash, mSeeds[GetBucket( hash )] )];
+
+        return entry.name == name ? &entry.value : nullptr;
+    }
+
+private:
+
+    enum
+    {
+        MaxSeed = 1 << 20
+    };
+
+    struct Entry
+    {
+        std::string_view name;
+        tValue value;
+    };
+
+    std::vector< uint32_t > mSeeds;
+    std::vector< Entry > mEntries;
+
+    size_t GetBucket( uint64_t hash ) const
+    {
+        return static_cast< size_t >( ( hash >> 32 ) % mSeeds.size() );
+    }
+
+    size_t GetPosition( uint64_t hash, uint32_t seed ) const
+    {
+        return static_cast< size_t >( ReflectionHelper::MixHash( hash ^ ( ( seed + 1 ) * 0x9e3779b97f4a7c15ULL ) ) %
+                                      mEntries.size() );
+    }
+
+    bool TryBuild( const std::vector< std::pair< std::string_view, tValue > > &entries,
+                   const std::vector< uint64_t > &hashes, size_t bucketCount )
+    {
+        mSeeds.assign( bucketCount, 0 );
+        mEntries.assign( entries.size(), Entry() );
+
+        std::vector< std::vector< uint32_t > > buckets( bucketCount );
+
+        for ( uint32_t i = 0; i < entries.size(); ++i )
+        {
+            buckets[GetBucket( hashes[i] )].push_back( i );
+        }
+
+        std::vector< uint32_t > order( bucketCount );
+
+        for ( uint32_t i = 0; i < bucketCount; ++i )
+        {
+            order[i] = i;
+        }
+
+        // place the largest buckets first, while most positions are still free
+        std::stable_sort( order.begin(), order.end(), [&buckets]( uint32_t a, uint32_t b )
+        {
+            return buckets[a].size() > buckets[b].size();
+        } );
+
+        std::vector< bool > taken( entries.size(), false );
+        std::vector< size_t > positions;
+
+        for ( uint32_t bucket : order )
+        {
+            const std::vector< uint32_t > &members = buckets[bucket];
+
+            if ( members.empty() )
+            {
+                break;
+            }
+
+            uint32_t seed = 0;
+
+            for ( ; seed < MaxSeed; ++seed )
+            {
+                positions.clear();
+
+                for ( uint32_t member : members )
+                {
+                    const size_t position = GetPosition( hashes[member], seed );
+
+                    if ( taken[position] || std::find( positions.begin(), positions.end(), position ) != positions.end() )
+                    {
+                        break;
+                    }
+
+                    positions.push_back( position );
+                }
+
+                if ( positions.size() == members.size() )
+                {
+                    break;
+                }
+            }
+
+            if ( seed == MaxSeed )
+            {
+                return false;
+            }
+
+            mSeeds[bucket] = seed;
+
+            for ( size_t i = 0; i < members.size(); ++i )
+            {
+                taken[positions[i]] = true;
+                mEntries[positions[i]] = Entry{ entries[members[i]].first, entries[members[i]].second };
+            }
+        }
+
+        return true;
+    }
+};
+
+#endif
\ No newline at end of file
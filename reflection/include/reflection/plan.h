@@ -0,0 +1,135 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_PLAN_H__
+#define __REFLECTION_PLAN_H__
+
+#include "reflection/util.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+class ITypeDescription;
+class AbstractProperty;
+struct ValueType;
+
+// A single step of a type plan, which acts on the value found offset bytes into the object
+struct PlanOp
+{
+    enum class Code : uint8_t
+    {
+        // Size bytes of trivially copyable properties
+        Copy,
+
+        // A string or vector, described by the value type
+        Sequence,
+
+        // A property without a fixed offset, accessed through the property itself, which may be a reflected class
+        Property,
+
+        // A pointer, which is not followed by the plan itself
+        Pointer
+    };
+
+    Code code;
+    uint32_t offset;
+    uint32_t size;
+    const ValueType *type;
+    const AbstractProperty *property;
+
+    // The custom flags of the properties, and of the class typed properties they were inlined from
+    uint32_t customFlags;
+};
+
+// A property of a type plan, in the order of AbstractProperties::GetView
+struct PlanField
+{
+    uint32_t offset;
+    uint32_t size;
+
+    // For a trivially copyable property at a fixed offset, the field after the run of adjacent trivially copyable
+    // properties it belongs to, and zero for any other property
+    uint32_t runEnd;
+
+    const ValueType *type;
+    const AbstractProperty *property;
+};
+
+/**
+ * The reflected properties of a type compiled to a flat list of operations. Adjacent trivially copyable properties
+ * with the same custom flags are merged into a single copy, and class typed properties at a fixed offset are inlined,
+ * so consumers such as the serialisers run a tight loop over the list instead of walking the property metadata of
+ * every object. Trivially copyable classes with reflected properties are inlined as well, so their padding is never
+ * part of a copy.
+ */
+class TypePlan
+{
+public:
+
+    explicit TypePlan( const ITypeDescription *type );
+
+    ArrayView< PlanOp > GetOps() const
+    {
+        return mOps;
+    }
+
+    // The properties of the type itself, without inlining class typed properties
+    ArrayView< PlanField > GetFields() const
+    {
+        return mFields;
+    }
+
+    // Whether the whole plan is a single copy, so arrays of objects can be handled as one block of runs
+    bool IsTrivial() const
+    {
+        return mOps.size() == 1 && mOps.front().code == PlanOp::Code::Copy;
+    }
+
+    // The number of bytes copied by the plan, not counting sequences and nested objects
+    size_t GetCopySize() const
+    {
+        return mCopySize;
+    }
+
+    // Whether a trivially copyable value is a class whose reflected properties are compiled in its place
+    static bool IsInlined( const ValueType &value );
+
+private:
+
+    std::vector< PlanOp > mOps;
+    std::vector< PlanField > mFields;
+    size_t mCopySize;
+
+    void Append( const PlanOp &op );
+
+    void CompileFields( const ITypeDescription *type );
+
+    void Compile( const ITypeDescription *type, uint32_t offset, uint32_t customFlags );
+};
+
+#endif
\ No newline at end of file
@@ -31,10 +31,15 @@
 #include "reflection/abstract/abstractProperty.h"
 
 #include "reflection/accessibility.h"
+#include "reflection/util.h"
 
+#include <type_traits>
 #include <typeindex>
 #include <stdint.h>
+#include <assert.h>
 #include <string>
+#include <vector>
+#include <new>
 
 template< class tClass, typename tProperty>
 class Property
@@ -49,7 +54,9 @@ class Property
 public:
 
     Property()
-        : mType( typeid( void ) ),
+        : mMemberPtr( nullptr ),
+          mBaseOffset( 0 ),
+          mType( typeid( void ) ),
           mPtrType( typeid( void * ) ),
           mName( nullptr ),
           mDescription( nullptr ),
@@ -60,7 +67,10 @@ public:
     }
 
     Property( const Property &property )
-        : mType( property.mType ),
+        : AbstractProperty( property ),
+          mMemberPtr( property.mMemberPtr ),
+          mBaseOffset( property.mBaseOffset ),
+          mType( property.mType ),
           mPtrType( property.mPtrType ),
           mName( property.mName ),
           mDescription( property.mDescription ),
@@ -116,6 +126,11 @@ public:
         return mAccessibility;
     }
 
+    virtual uint32_t GetCustomFlags() const override
+    {
+        return mCustomFlags;
+    }
+
     void Set( tClass &object, const tProperty &propert )
     {
         AbstractProperty::Set< tClass, tProperty >( object, propert );
@@ -126,11 +141,42 @@ public:
         return AbstractProperty::Get< tProperty, tClass >( object );
     }
 
+    using AbstractProperty::Gather;
+    using AbstractProperty::Scatter;
+
+    void Gather( const tClass *objects, size_t count, tProperty *output ) const
+    {
+        AbstractProperty::Gather( objects, sizeof( tClass ), count, output );
+    }
+
+    std::vector< tProperty > Gather( const std::vector< tClass > &objects ) const
+    {
+        std::vector< tProperty > values( objects.size() );
+        Gather( objects.data(), objects.size(), values.data() );
+
+        return values;
+    }
+
+    void Scatter( const tProperty *input, tClass *objects, size_t count ) const
+    {
+        AbstractProperty::Scatter( input, objects, sizeof( tClass ), count );
+    }
+
+    void Scatter( const std::vector< tProperty > &input, std::vector< tClass > &objects ) const
+    {
+        assert( input.size() == objects.size() );
+        Scatter( input.data(), objects.data(), objects.size() );
+    }
+
 protected:
 
     Property( tProperty tClass::*variable, Accessibility accessibility, const char *name,
               const char *description, uint32_t customFlags, size_t index )
-        : mMemberPtr( variable ),
+        : AbstractProperty( ValueType::Get< tProperty >(),
+                            ReflectionHelper::OffsetOf( variable ),
+                            GetLayoutFlags() ),
+          mMemberPtr( variable ),
+          mBaseOffset( 0 ),
           mType( typeid( tProperty ) ),
           mPtrType( typeid( variable ) ),
           mName( name ),
@@ -143,17 +189,54 @@ protected:
 
     void *Get( void *obj ) const
     {
-        return static_cast< void * >( &( *static_cast< tClass * >( obj ).*mMemberPtr ) );
+        return static_cast< void * >( &( GetOwner( obj ).*mMemberPtr ) );
     }
 
     void Set( void *obj, void *val )
     {
-        ( *static_cast< tClass * >( obj ) ).*mMemberPtr = *static_cast< const tProperty *>( val );
+        GetOwner( obj ).*mMemberPtr = *static_cast< const tProperty *>( val );
+    }
+
+    size_t GetStorageSize() const override
+    {
+        return sizeof( Property );
+    }
+
+    void GatherValues( const void *objects, size_t stride, size_t count, void *output ) const override
+    {
+        const uint8_t *object = static_cast< const uint8_t * >( objects );
+        tProperty *values = static_cast< tProperty * >( output );
+
+        for ( size_t i = 0; i < count; ++i, object += stride )
+        {
+            values[i] = GetOwner( const_cast< uint8_t * >( object ) ).*mMemberPtr;
+        }
+    }
+
+    void ScatterValues( const void *input, void *objects, size_t stride, size_t count ) const override
+    {
+        uint8_t *object = static_cast< uint8_t * >( objects );
+        const tProperty *values = static_cast< const tProperty * >( input );
+
+        for ( size_t i = 0; i < count; ++i, object += stride )
+        {
+            GetOwner( object ).*mMemberPtr = values[i];
+        }
+    }
+
+    AbstractProperty *CloneInto( void *storage, ptrdiff_t baseOffset ) const override
+    {
+        Property *property = new( storage ) Property( *this );
+        property->mBaseOffset += baseOffset;
+        property->mOffset += static_cast< uint32_t >( baseOffset );
+
+        return property;
     }
 
 private:
 
     tProperty tClass::*mMemberPtr;
+    ptrdiff_t mBaseOffset;
     std::type_index mType;
     std::type_index mPtrType;
     const char *mName;
@@ -161,6 +244,17 @@ private:
     size_t mIndex;
     uint32_t mCustomFlags;
     Accessibility mAccessibility;
+
+    static uint32_t GetLayoutFlags()
+    {
+        return ( std::is_standard_layout< tClass >::value ? LayoutFlags::HasOffset : 0 ) |
+               ( std::is_trivially_copyable< tProperty >::value ? LayoutFlags::IsTriviallyCopyable : 0 );
+    }
+
+    tClass &GetOwner( void *obj ) const
+    {
+        return *reinterpret_cast< tClass * >( static_cast< uint8_t * >( obj ) + mBaseOffset );
+    }
 };
 
 #endif
\ No newline at end of file
@@ -32,26 +32,65 @@
 
 namespace Reflect
 {
-    const ITypeDescription *GetType( const std::string &name );
+    const ITypeDescription *GetType( std::string_view name );
 
+    const ITypeDescription *GetType( uint64_t typeId );
+
+    // The registered types that have all of the ITypeDescription::Type flags, such as all polymorphic types with
+    // reflected properties
+    std::vector< const ITypeDescription * > FindTypes( uint32_t flags );
+
+    // The default type ID of a type, which is used unless the type declares its own in Reflect( Mirror & ). It is
+    // not guaranteed to be the same across compilers, so persisted type IDs should always be declared.
+    template< class tClass >
+    constexpr uint64_t HashTypeName()
+    {
+        return ReflectionHelper::TypeID< tClass >::value;
+    }
+
+    // Only classes are registered, other types have nothing to reflect and are described from static storage.
+    // A class that was not registered before Freeze() returns nullptr, and asserts in debug builds.
     template< class tClass >
     inline const TypeDescription< tClass > *GetType()
     {
-        return InternalReflection::GetInstance()->ReflectType< tClass >();
+        if constexpr ( std::is_class< tClass >::value )
+        {
+            return InternalReflection::GetInstance()->ReflectType< tClass >();
+        }
+        else
+        {
+            static const TypeDescription< tClass > type;
+
+            return &type;
+        }
     }
 
     template< class tClass >
     inline bool IsRegistered()
     {
-        return InternalReflection::GetInstance()->IsRegistered< tClass >();
+        if constexpr ( std::is_class< tClass >::value )
+        {
+            return InternalReflection::GetInstance()->IsRegistered< tClass >();
+        }
+        else
+        {
+            return false;
+        }
     }
 
     template< class tClass >
     inline void Clear()
     {
-        InternalReflection::GetInstance()->ClearType< tClass >();
+        if constexpr ( std::is_class< tClass >::value )
+        {
+            InternalReflection::GetInstance()->ClearType< tClass >();
+        }
     }
 
     void ClearAll();
+
+    void Freeze();
+
+    bool IsFrozen();
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,375 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_REFLECTEDVECTOR_H__
+#define __REFLECTION_REFLECTEDVECTOR_H__
+
+#include "reflection/reflection.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <string.h>
+#include <vector>
+#include <new>
+
+#ifndef REFLECTION_COLUMN_ALIGNMENT
+#   define REFLECTION_COLUMN_ALIGNMENT 64
+#endif
+
+/**
+ * A structure of arrays container that stores every reflected property of tClass in its own contiguous column,
+ * so scans over a single property only touch the bytes of that property. Properties that are not reflected are
+ * not stored, and are default constructed when a row is read back as a tClass.
+ *
+ * The columns are described by the registered properties, so the type must stay registered while the container
+ * is alive.
+ */
+template< class tClass >
+class ReflectedVector
+{
+public:
+
+    class Row
+    {
+    public:
+
+        Row( ReflectedVector *vector, size_t index )
+            : mVector( vector ),
+              mIndex( index )
+        {
+        }
+
+        template< typename tProperty >
+        tProperty &operator[]( tProperty tClass::*member ) const
+        {
+            return mVector->GetColumnByMemberPtr( member )[mIndex];
+        }
+
+        template< typename tProperty >
+        tProperty &Get( size_t propertyIndex ) const
+        {
+            return mVector->template GetColumn< tProperty >( propertyIndex )[mIndex];
+        }
+
+        operator tClass() const
+        {
+            return mVector->Get( mIndex );
+        }
+
+        Row &operator=( const tClass &object )
+        {
+            mVector->Set( mIndex, object );
+            return *this;
+        }
+
+        size_t GetIndex() const
+        {
+            return mIndex;
+        }
+
+    private:
+
+        ReflectedVector *mVector;
+        size_t mIndex;
+    };
+
+    ReflectedVector()
+        : mProperties( Reflect::GetType< tClass >()->GetProperties() ),
+          mSize( 0 ),
+          mCapacity( 0 )
+    {
+        static_assert( std::is_class< tClass >::value, "A reflected vector stores the properties of a class." );
+
+        for ( AbstractProperty *property : mProperties->GetView() )
+        {
+            mColumns.push_back( { property, &property->GetValueType(), nullptr } );
+        }
+    }
+
+    ReflectedVector( ReflectedVector &&other )
+        : mProperties( other.mProperties ),
+          mColumns( std::move( other.mColumns ) ),
+          mSize( other.mSize ),
+          mCapacity( other.mCapacity )
+    {
+        other.mColumns.clear();
+        other.mSize = 0;
+        other.mCapacity = 0;
+    }
+
+    ReflectedVector( const ReflectedVector & ) = delete;
+    ReflectedVector &operator=( const ReflectedVector & ) = delete;
+
+    ~ReflectedVector()
+    {
+        clear();
+
+        for ( Column &column : mColumns )
+        {
+            Deallocate( column.data );
+        }
+    }
+
+    size_t size() const
+    {
+        return mSize;
+    }
+
+    size_t capacity() const
+    {
+        return mCapacity;
+    }
+
+    bool empty() const
+    {
+        return mSize == 0;
+    }
+
+    size_t GetColumnCount() const
+    {
+        return mColumns.size();
+    }
+
+    void reserve( size_t capacity )
+    {
+        if ( capacity <= mCapacity )
+        {
+            return;
+        }
+
+        for ( Column &column : mColumns )
+        {
+            void *data = Allocate( capacity * column.type->size );
+
+            if ( column.data )
+            {
+                column.type->relocate( data, column.data, mSize );
+                Deallocate( column.data );
+            }
+
+            column.data = data;
+        }
+
+        mCapacity = capacity;
+    }
+
+    void push_back( const tClass &object )
+    {
+        Grow();
+
+        for ( Column &column : mColumns )
+        {
+            void *value = column.At( mSize );
+            column.type->construct( value, 1 );
+            Assign( column, value, object );
+        }
+
+        ++mSize;
+    }
+
+    void pop_back()
+    {
+        assert( mSize > 0 );
+
+        --mSize;
+
+        for ( Column &column : mColumns )
+        {
+            column.type->destroy( column.At( mSize ), 1 );
+        }
+    }
+
+    // Removes the row and shifts the rows after it down in every column
+    void erase( size_t index )
+    {
+        assert( index < mSize );
+
+        for ( Column &column : mColumns )
+        {
+            if ( column.type->isTriviallyCopyable )
+            {
+                memmove( column.At( index ), column.At( index + 1 ), ( mSize - index - 1 ) * column.type->size );
+            }
+            else
+            {
+                for ( size_t i = index; i + 1 < mSize; ++i )
+                {
+                    column.type->move( column.At( i ), column.At( i + 1 ) );
+                }
+            }
+        }
+
+        pop_back();
+    }
+
+    void clear()
+    {
+        for ( Column &column : mColumns )
+        {
+            if ( column.data )
+            {
+                column.type->destroy( column.data, mSize );
+            }
+        }
+
+        mSize = 0;
+    }
+
+    Row operator[]( size_t index )
+    {
+        assert( index < mSize );
+        return Row( this, index );
+    }
+
+    // Assembles the row into an object, leaving the properties that are not reflected default constructed
+    tClass Get( size_t index ) const
+    {
+        assert( index < mSize );
+
+        tClass object;
+
+        for ( const Column &column : mColumns )
+        {
+            if ( column.property->HasOffset() && column.type->isTriviallyCopyable )
+            {
+                memcpy( column.property->GetAddress( &object ), column.At( index ), column.type->size );
+            }
+            else
+            {
+                column.type->copy( column.property->Get( &object ), column.At( index ) );
+            }
+        }
+
+        return object;
+    }
+
+    void Set( size_t index, const tClass &object )
+    {
+        assert( index < mSize );
+
+        for ( Column &column : mColumns )
+        {
+            Assign( column, column.At( index ), object );
+        }
+    }
+
+    template< typename tProperty >
+    tProperty *GetColumnByMemberPtr( tProperty tClass::*member )
+    {
+        return static_cast< tProperty * >( FindColumn( mProperties->GetByMemberPtr( member ) ).data );
+    }
+
+    template< typename tProperty >
+    const tProperty *GetColumnByMemberPtr( tProperty tClass::*member ) const
+    {
+        return static_cast< const tProperty * >( FindColumn( mProperties->GetByMemberPtr( member ) ).data );
+    }
+
+    template< typename tProperty >
+    tProperty *GetColumn( size_t propertyIndex )
+    {
+        return static_cast< tProperty * >( FindColumn( mProperties->template Get< tProperty >( propertyIndex ) ).data );
+    }
+
+    template< typename tProperty >
+    const tProperty *GetColumn( size_t propertyIndex ) const
+    {
+        return static_cast< const tProperty * >( FindColumn( mProperties->template Get< tProperty >( propertyIndex ) ).data );
+    }
+
+private:
+
+    struct Column
+    {
+        AbstractProperty *property;
+        const ValueType *type;
+        void *data;
+
+        void *At( size_t index ) const
+        {
+            return static_cast< uint8_t * >( data ) + index * type->size;
+        }
+    };
+
+    const Properties< tClass > *mProperties;
+    std::vector< Column > mColumns;
+    size_t mSize;
+    size_t mCapacity;
+
+    static void *Allocate( size_t size )
+    {
+        return ::operator new( size, std::align_val_t( REFLECTION_COLUMN_ALIGNMENT ) );
+    }
+
+    static void Deallocate( void *data )
+    {
+        if ( data )
+        {
+            ::operator delete( data, std::align_val_t( REFLECTION_COLUMN_ALIGNMENT ) );
+        }
+    }
+
+    void Grow()
+    {
+        if ( mSize == mCapacity )
+        {
+            reserve( std::max< size_t >( 8, mCapacity * 2 ) );
+        }
+    }
+
+    const Column &FindColumn( const AbstractProperty *property ) const
+    {
+        assert( property && "The member is not a reflected property." );
+
+        for ( const Column &column : mColumns )
+        {
+            if ( column.property == property )
+            {
+                return column;
+            }
+        }
+
+        assert( false && "The member is not a reflected property." );
+        return mColumns.front();
+    }
+
+    static void Assign( const Column &column, void *value, const tClass &object )
+    {
+        const AbstractProperty *property = column.property;
+
+        if ( property->HasOffset() && column.type->isTriviallyCopyable )
+        {
+            memcpy( value, property->GetAddress( &object ), column.type->size );
+        }
+        else
+        {
+            column.type->copy( value, property->Get( const_cast< tClass * >( &object ) ) );
+        }
+    }
+};
+
+#endif
\ No newline at end of file
@@ -30,11 +30,19 @@
 
 #include "reflection/abstract/ITypeDescription.h"
 #include "reflection/typeDescription.h"
+#include "reflection/typeTable.h"
+#include "reflection/nameIndex.h"
 #include "reflection/mirror.h"
+#include "reflection/visitor.h"
 
 #include <unordered_map>
+#include <string_view>
 #include <typeindex>
 #include <typeinfo>
+#include <utility>
+#include <stdexcept>
+#include <atomic>
+#include <vector>
 #include <mutex>
 
 namespace ReflectionHelper
@@ -44,7 +52,7 @@ namespace ReflectionHelper
     {
     private:
 
-        template <typename tClass> static uint8_t test( decltype( &tClass::Reflect ) );
+        template <typename tClass> static uint8_t test( decltype( tClass::Reflect( std::declval< Mirror & >() ), 0 ) );
         template <typename tClass> static uint32_t test( ... );
 
     public:
@@ -87,80 +95,167 @@ public:
 
     ~InternalReflection();
 
-    ITypeDescription *ReflectType( const std::string &name ) const
+    ITypeDescription *ReflectType( std::string_view name ) const
     {
-        auto nameIt = mNameCache.find( name );
+        if ( mFrozen )
+        {
+            ITypeDescription *const *type = mNameIndex.Find( name );
 
-        if ( nameIt != mNameCache.end() )
+            return type ? *type : nullptr;
+        }
+
+        std::lock_guard< std::recursive_mutex > lock( mRegistryLock );
+
+        return FindType( name );
+    }
+
+    ITypeDescription *ReflectType( uint64_t typeId ) const
+    {
+        if ( mFrozen )
         {
-            return mTypes.find( nameIt->second )->second;
+            return FindType( typeId );
         }
 
-        return nullptr;
+        std::lock_guard< std::recursive_mutex > lock( mRegistryLock );
+
+        return FindType( typeId );
     }
 
+    /**
+     * Returns the type description, registering the type on its first lookup. Registering a type whose type ID
+     * is already taken by another type throws std::logic_error and leaves the type unregistered. Once the registry
+     * is frozen no types can be registered anymore, so a type that was not registered before freezing asserts in
+     * debug builds and returns nullptr in release builds.
+     */
     template< class tClass >
     TypeDescription< tClass > *ReflectType()
     {
-        const size_t typeId = GetClassID< tClass >();
+        if ( mFrozen )
+        {
+            // the tables are immutable after freezing, so plain reads are safe from any thread
+            ITypeDescription *type = SlotCache< tClass >::owner.load( std::memory_order_relaxed ) == this ?
+                                     *SlotCache< tClass >::slot : mTypes.Find( GetClassID< tClass >() );
+
+            assert( type && "A type cannot be registered after the registry is frozen." );
+
+            return static_cast< TypeDescription< tClass > * >( type );
+        }
 
-        auto type = mTypes.find( typeId );
+        // a type is published in its slot cache once its registration completed, so only a miss takes the lock
+        ITypeDescription *published = SlotCache< tClass >::type.load( std::memory_order_acquire );
 
-        if ( type == mTypes.end() )
+        if ( published && SlotCache< tClass >::owner.load( std::memory_order_relaxed ) == this )
         {
+            return static_cast< TypeDescription< tClass > * >( published );
+        }
+
+        std::lock_guard< std::recursive_mutex > lock( mRegistryLock );
 
+        ITypeDescription **slot = GetSlot< tClass >();
+
+        if ( !*slot )
+        {
             TypeDescription< tClass > *typeDescription = new TypeDescription< tClass >();
             Mirror mirror( typeDescription );
 
             // prevent infinite recursion by adding the pointer already
-            mTypes[ typeId ] = typeDescription;
+            *slot = typeDescription;
 
-            Helper< tClass, std::is_class< tClass >::value >::Reflect( mirror );
+            try
+            {
+                Helper< tClass, std::is_class< tClass >::value >::Reflect( mirror );
+
+                mirror.mTypeDescription->Finalize();
+
+                RegisterTypeID( typeDescription );
+            }
+            catch ( ... )
+            {
+                // a failed registration leaves no trace, e.g. when the type ID collides
+                *slot = nullptr;
+                delete typeDescription;
+
+                throw;
+            }
 
             if ( mirror.mTypeDescription->GetCName() && !mirror.mTypeDescription->IsBaseClass() )
             {
-                mNameCache[mirror.mTypeDescription->GetName()] = typeId;
+                mNameCache[mirror.mTypeDescription->GetCName()] = GetClassID< tClass >();
             }
 
-            return static_cast< TypeDescription< tClass > * >( typeDescription );
-        }
-        else
-        {
-            return static_cast< TypeDescription< tClass > * >( type->second );
+            IndexType( typeDescription, GetClassID< tClass >() );
+
+            SlotCache< tClass >::type.store( typeDescription, std::memory_order_release );
+            mPublished.push_back( &SlotCache< tClass >::type );
+
+            return typeDescription;
         }
+
+        return static_cast< TypeDescription< tClass > * >( *slot );
     }
 
     template< class tClass >
     void ClearType()
     {
-        const size_t typeId = GetClassID< tClass >();
+        std::lock_guard< std::recursive_mutex > lock( mRegistryLock );
+        assert( !mFrozen && "A type cannot be cleared while the registry is frozen." );
 
-        auto type = mTypes.find( typeId );
+        ITypeDescription **slot = GetSlot< tClass >();
 
-        if ( type != mTypes.end() )
-        {
-            auto nameIt = mNameCache.find( type->second->GetName() );
+        SlotCache< tClass >::type.store( nullptr, std::memory_order_relaxed );
 
-            if ( nameIt != mNameCache.end() )
+        if ( *slot )
+        {
+            if ( ( *slot )->GetCName() )
             {
-                mNameCache.erase( nameIt );
+                mNameCache.erase( ( *slot )->GetCName() );
             }
 
-            delete type->second;
-            mTypes.erase( type );
+            UnregisterTypeID( *slot );
+            UnindexType( GetClassID< tClass >() );
+
+            delete *slot;
+            *slot = nullptr;
         }
     }
 
     template< class tClass >
     bool IsRegistered()
     {
-        const size_t typeId = GetClassID< tClass >();
+        if ( mFrozen )
+        {
+            return mTypes.Find( GetClassID< tClass >() ) != nullptr;
+        }
 
-        return mTypes.find( typeId ) != mTypes.end();
+        std::lock_guard< std::recursive_mutex > lock( mRegistryLock );
+
+        return mTypes.Find( GetClassID< tClass >() ) != nullptr;
     }
 
     void ClearTypes();
 
+    // The registered types that have all of the ITypeDescription::Type flags
+    std::vector< const ITypeDescription * > FindTypes( uint32_t flags ) const
+    {
+        if ( mFrozen )
+        {
+            return CollectTypes( flags );
+        }
+
+        std::lock_guard< std::recursive_mutex > lock( mRegistryLock );
+
+        return CollectTypes( flags );
+    }
+
+    /**
+     * Publishes the registered types as an immutable snapshot. Lookups on a frozen registry take no locks, but
+     * registering or clearing types is no longer allowed until the registry is cleared. The freeze should
+     * happen-before the lookups that depend on it, e.g. by freezing before the reader threads are started.
+     */
+    void Freeze();
+
+    bool IsFrozen() const;
+
     template< typename tT >
     size_t GetClassID()
     {
@@ -171,12 +266,75 @@ public:
 
 private:
 
-    std::unordered_map< size_t, ITypeDescription * > mTypes;
-    std::unordered_map< std::type_index, size_t > mClassIDCache;
-    std::unordered_map< std::string, size_t > mNameCache;
+    TypeTable mTypes;
+    std::unordered_map< std::string_view, size_t > mNameCache;
+    std::unordered_map< uint64_t, ITypeDescription * > mTypeIDs;
+    NameIndex< ITypeDescription * > mNameIndex;
+
+    // The slot caches that published a type of this registry, which are reset when the types are cleared
+    std::vector< std::atomic< ITypeDescription * > * > mPublished;
+
+    // The class IDs of the registered types, and of the registered types with each flag, as bitsets
+    std::vector< uint64_t > mRegistered;
+    std::vector< uint64_t > mFlagIndex[ITypeDescription::FlagCount];
+
+    mutable std::recursive_mutex mRegistryLock;
+    std::atomic< size_t > mClassIDCounter;
+    bool mFrozen;
+
+    void RegisterTypeID( ITypeDescription *type );
+
+    void UnregisterTypeID( ITypeDescription *type );
+
+    void IndexType( const ITypeDescription *type, size_t classId );
+
+    void UnindexType( size_t classId );
+
+    std::vector< const ITypeDescription * > CollectTypes( uint32_t flags ) const;
 
-    mutable std::mutex mClassIDLock;
-    size_t mClassIDCounter;
+    ITypeDescription *FindType( uint64_t typeId ) const
+    {
+        auto typeIt = mTypeIDs.find( typeId );
+
+        return typeIt != mTypeIDs.end() ? typeIt->second : nullptr;
+    }
+
+    ITypeDescription *FindType( std::string_view name ) const
+    {
+        auto nameIt = mNameCache.find( name );
+
+        if ( nameIt != mNameCache.end() )
+        {
+            return mTypes.Find( nameIt->second );
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * Caches the type table slot of a type, so a lookup does not have to go through its class ID. The completely
+     * registered type is published as well, so lookups before freezing can skip the registry lock.
+     */
+    template< class tClass >
+    struct SlotCache
+    {
+        static std::atomic< const InternalReflection * > owner;
+        static ITypeDescription **slot;
+        static std::atomic< ITypeDescription * > type;
+    };
+
+    template< class tClass >
+    ITypeDescription **GetSlot()
+    {
+        if ( SlotCache< tClass >::owner.load( std::memory_order_relaxed ) != this )
+        {
+            SlotCache< tClass >::type.store( nullptr, std::memory_order_relaxed );
+            SlotCache< tClass >::slot = mTypes.GetSlot( GetClassID< tClass >() );
+            SlotCache< tClass >::owner.store( this, std::memory_order_relaxed );
+        }
+
+        return SlotCache< tClass >::slot;
+    }
 
     template< class tClass, bool tIsClass >
     struct Helper
@@ -198,31 +356,24 @@ private:
     template< typename tT >
     static size_t AssignClassID( InternalReflection &reflection )
     {
-        static size_t mClassId = CacheClassID< tT >( reflection );
+        static size_t mClassId = ++reflection.mClassIDCounter;
 
         assert( mClassId > 0 && "A class ID of 0 is not allowed." );
 
         return mClassId;
     }
 
-    template< typename tT >
-    static size_t CacheClassID( InternalReflection &reflection )
-    {
-        const std::type_index typeIndex = std::type_index( typeid( tT ) );
-
-        std::lock_guard< std::mutex > lock( reflection.mClassIDLock );
+} gInternalReflection;
 
-        auto it = reflection.mClassIDCache.find( typeIndex );
+template< class tClass >
+std::atomic< const InternalReflection * > InternalReflection::SlotCache< tClass >::owner( nullptr );
 
-        if ( it == reflection.mClassIDCache.end() )
-        {
-            reflection.mClassIDCache.insert( std::make_pair( typeIndex, ++reflection.mClassIDCounter ) );
-            return reflection.mClassIDCounter;
-        }
+template< class tClass >
+ITypeDescription **InternalReflection::SlotCache< tClass >::slot = nullptr;
 
-        return it->second;
-    }
+template< class tClass >
+std::atomic< ITypeDescription * > InternalReflection::SlotCache< tClass >::type( nullptr );
 
-} gInternalReflection;
+#include "reflection/reflect.h"
 
 #endif
\ No newline at end of file
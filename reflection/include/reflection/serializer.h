@@ -0,0 +1,245 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_SERIALIZER_H__
+#define __REFLECTION_SERIALIZER_H__
+
+#include "reflection/reflection.h"
+
+#include <assert.h>
+#include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// Appends raw bytes to a reusable buffer
+class BinaryWriter
+{
+public:
+
+    explicit BinaryWriter( std::vector< uint8_t > &buffer )
+        : mBuffer( buffer )
+    {
+    }
+
+    void Write( const void *data, size_t size )
+    {
+        const uint8_t *bytes = static_cast< const uint8_t * >( data );
+        mBuffer.insert( mBuffer.end(), bytes, bytes + size );
+    }
+
+    void WriteCount( size_t count )
+    {
+        assert( count <= UINT32_MAX && "A sequence cannot hold more than 2^32 - 1 elements." );
+
+        const uint32_t value = static_cast< uint32_t >( count );
+        Write( &value, sizeof( value ) );
+    }
+
+    // Writes seven bits per byte, with the high bit set on every byte but the last
+    void WriteVarInt( uint64_t value )
+    {
+        uint8_t bytes[MaxVarIntSize];
+        Write( bytes, EncodeVarInt( value, bytes ) );
+    }
+
+    static size_t EncodeVarInt( uint64_t value, uint8_t *bytes )
+    {
+        size_t size = 0;
+
+        for ( ; value >= 0x80; value >>= 7 )
+        {
+            bytes[size++] = static_cast< uint8_t >( value | 0x80 );
+        }
+
+        bytes[size++] = static_cast< uint8_t >( value );
+        return size;
+    }
+
+    std::vector< uint8_t > &GetBuffer() const
+    {
+        return mBuffer;
+    }
+
+    enum
+    {
+        MaxVarIntSize = 10
+    };
+
+private:
+
+    std::vector< uint8_t > &mBuffer;
+};
+
+// Reads raw bytes from a buffer, failing instead of reading past its end
+class BinaryReader
+{
+public:
+
+    BinaryReader( const uint8_t *data, size_t size )
+        : mCursor( data ),
+          mEnd( data + size )
+    {
+    }
+
+    bool Read( void *data, size_t size )
+    {
+        if ( size > GetRemaining() )
+        {
+            return false;
+        }
+
+        if ( size > 0 )
+        {
+            memcpy( data, mCursor, size );
+        }
+
+        mCursor += size;
+        return true;
+    }
+
+    bool ReadCount( size_t &count )
+    {
+        uint32_t value;
+
+        if ( !Read( &value, sizeof( value ) ) )
+        {
+            return false;
+        }
+
+        count = value;
+        return true;
+    }
+
+    bool ReadVarInt( uint64_t &value )
+    {
+        value = 0;
+
+        for ( uint32_t shift = 0; shift < 64 && mCursor < mEnd; shift += 7 )
+        {
+            const uint8_t byte = *mCursor++;
+            value |= static_cast< uint64_t >( byte & 0x7f ) << shift;
+
+            if ( byte < 0x80 )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool Skip( size_t size )
+    {
+        if ( size > GetRemaining() )
+        {
+            return false;
+        }
+
+        mCursor += size;
+        return true;
+    }
+
+    size_t GetRemaining() const
+    {
+        return static_cast< size_t >( mEnd - mCursor );
+    }
+
+    const uint8_t *GetCursor() const
+    {
+        return mCursor;
+    }
+
+private:
+
+    const uint8_t *mCursor;
+    const uint8_t *mEnd;
+};
+
+// Writes the pointers met by the binary format, which skips them without one
+class PointerWriter
+{
+public:
+
+    virtual ~PointerWriter() = default;
+
+    virtual void Write( const ValueType &type, const void *pointer, BinaryWriter &writer ) = 0;
+};
+
+// Reads the pointers written by a pointer writer
+class PointerReader
+{
+public:
+
+    virtual ~PointerReader() = default;
+
+    virtual bool Read( const ValueType &type, void *pointer, BinaryReader &reader ) = 0;
+};
+
+/**
+ * A binary format that writes the reflected properties in declaration order, in the byte order of the host.
+ * Adjacent trivially copyable properties are written as one run, sequences as a 32 bit element count followed by
+ * their elements, and class typed properties through their own reflected properties. Pointers are not followed,
+ * they are left to the pointer writer and reader when given.
+ */
+namespace Reflect
+{
+    void Serialize( const ITypeDescription *type, const void *object, BinaryWriter &writer,
+                    PointerWriter *pointers = nullptr );
+
+    // Deserialises into an existing object, reusing the capacity of its strings and vectors
+    bool Deserialize( const ITypeDescription *type, void *object, BinaryReader &reader,
+                      PointerReader *pointers = nullptr );
+
+    // Write and read a single value, as it is written for a property of that type
+    void SerializeValue( const ValueType &type, const void *value, BinaryWriter &writer,
+                         PointerWriter *pointers = nullptr );
+    bool DeserializeValue( const ValueType &type, void *value, BinaryReader &reader,
+                           PointerReader *pointers = nullptr );
+
+    template< class tClass >
+    inline void Serialize( const tClass &object, std::vector< uint8_t > &buffer )
+    {
+        BinaryWriter writer( buffer );
+        Serialize( GetType< tClass >(), &object, writer );
+    }
+
+    template< class tClass >
+    inline bool Deserialize( const uint8_t *data, size_t size, tClass &object )
+    {
+        BinaryReader reader( data, size );
+        return Deserialize( GetType< tClass >(), &object, reader );
+    }
+
+    template< class tClass >
+    inline bool Deserialize( const std::vector< uint8_t > &buffer, tClass &object )
+    {
+        return Deserialize( buffer.data(), buffer.size(), object );
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,69 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_TAGGEDSERIALIZER_H__
+#define __REFLECTION_TAGGEDSERIALIZER_H__
+
+#include "reflection/serializer.h"
+
+/**
+ * A tag-length-value format keyed by the stable property indices, so readers and writers built from different
+ * versions of a type can exchange data. Every field is written as a varint key, a varint length and its payload.
+ * The key is the property index shifted left by one, or the base class index shifted left by one with the low bit
+ * set for the nested fields of a base class. Nested reflected classes are written field by field in the same way,
+ * even when they are trivially copyable. Readers skip unknown fields and raw trivially copyable fields whose size
+ * changed.
+ */
+namespace Reflect
+{
+    void SerializeTagged( const ITypeDescription *type, const void *object, BinaryWriter &writer );
+
+    // Reads fields until the reader is exhausted, into an existing object
+    bool DeserializeTagged( const ITypeDescription *type, void *object, BinaryReader &reader );
+
+    template< class tClass >
+    inline void SerializeTagged( const tClass &object, std::vector< uint8_t > &buffer )
+    {
+        BinaryWriter writer( buffer );
+        SerializeTagged( GetType< tClass >(), &object, writer );
+    }
+
+    template< class tClass >
+    inline bool DeserializeTagged( const uint8_t *data, size_t size, tClass &object )
+    {
+        BinaryReader reader( data, size );
+        return DeserializeTagged( GetType< tClass >(), &object, reader );
+    }
+
+    template< class tClass >
+    inline bool DeserializeTagged( const std::vector< uint8_t > &buffer, tClass &object )
+    {
+        return DeserializeTagged( buffer.data(), buffer.size(), object );
+    }
+}
+
+#endif
\ No newline at end of file
@@ -32,15 +32,22 @@
 
 #include "reflection/property.h"
 #include "reflection/defines.h"
+#include "reflection/typeId.h"
+#include "reflection/nameIndex.h"
 #include "reflection/util.h"
 
+#include <string_view>
 #include <typeindex>
 #include <stdint.h>
 #include <assert.h>
+#include <string.h>
 #include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <cstddef>
 #include <array>
-#include <map>
 #include <set>
+#include <functional>
 
 template<class tClass>
 class TypeDescription;
@@ -61,6 +68,49 @@ public:
     {
     }
 
+    // All properties, including those of the base classes, without allocating
+    virtual ArrayView<AbstractProperty *> GetView() const = 0;
+
+    // The properties declared by the class itself
+    virtual ArrayView<AbstractProperty *> GetDeclaredView() const = 0;
+
+    // The declared property with the index, or nullptr
+    virtual AbstractProperty *FindByIndex( size_t index ) const = 0;
+
+    // The property with the name, including those of the base classes, or nullptr
+    virtual AbstractProperty *FindByName( std::string_view name ) const = 0;
+
+    // The named properties in declaration order, without those hidden by a declared property of the same name
+    virtual ArrayView<AbstractProperty *> GetNamedView() const = 0;
+
+    // All properties with the custom flag, a single bit, in the order of GetView() and without allocating
+    virtual ArrayView<AbstractProperty *> GetFlaggedView( uint32_t flag ) const = 0;
+
+    // All properties that match the accessibility query, grouped by accessibility and without allocating
+    virtual ArrayView<AbstractProperty *> GetAccessibleView(
+        Accessibility accessibility, AccessibilityType type = AccessibilityType::DownTo ) const = 0;
+
+    // All properties with the value type, in the order of GetView() and without allocating
+    virtual ArrayView<AbstractProperty *> GetTypedView( const ValueType &type ) const = 0;
+
+    // All properties with the value type that match the accessibility query, grouped like GetAccessibleView()
+    virtual ArrayView<AbstractProperty *> GetTypedView(
+        const ValueType &type, Accessibility accessibility,
+        AccessibilityType accessibilityType = AccessibilityType::DownTo ) const = 0;
+
+    template<typename tProperty>
+    ArrayView<AbstractProperty *> GetTypedView() const
+    {
+        return GetTypedView( ValueType::Get<tProperty>() );
+    }
+
+    template<typename tProperty>
+    ArrayView<AbstractProperty *> GetTypedView( Accessibility accessibility,
+                                                AccessibilityType type = AccessibilityType::DownTo ) const
+    {
+        return GetTypedView( ValueType::Get<tProperty>(), accessibility, type );
+    }
+
     virtual std::vector<AbstractProperty *> GetAll() const = 0;
     virtual std::vector<AbstractProperty *> GetAll( Accessibility accessibility,
                                                     AccessibilityType type = AccessibilityType::DownTo ) const = 0;
@@ -76,105 +126,197 @@ class Properties
 {
     friend class Mirror;
 
+    template<class tTypeClass>
+    friend class TypeDescription;
+
 public:
 
     explicit Properties( TypeDescription<tClass> *type )
-        : mType( type )
+        : mFlagOffsets{},
+          mAccessibleOffsets{},
+          mStorage( nullptr ),
+          mType( type )
     {
 
     }
 
     ~Properties()
     {
-        for ( auto &property : mProperties )
+        if ( mStorage )
         {
-            delete property.second;
+            for ( AbstractProperty *property : mAllProperties )
+            {
+                property->~AbstractProperty();
+            }
+
+            ::operator delete( mStorage );
+        }
+        else
+        {
+            for ( AbstractProperty *property : mProperties )
+            {
+                delete property;
+            }
         }
     }
 
+    Properties( const Properties & ) = delete;
+    Properties &operator=( const Properties & ) = delete;
+
     template< class tClass2, typename tProperty, typename = typename std::enable_if< std::is_class<tClass2>::value >::type >
     Property< tClass, tProperty> *GetByMemberPtr( tProperty tClass2::*variable ) const
     {
-        return mProperties.at( MemberPtrToArray( variable ) );
+        const MemberPtrArray key = MemberPtrToArray( variable );
+        auto it = std::lower_bound( mPropertyMemberPtrs.begin(), mPropertyMemberPtrs.end(), key, LessKey() );
+
+        if ( it == mPropertyMemberPtrs.end() || it->first != key )
+        {
+            throw std::out_of_range( "No property is registered for the member pointer." );
+        }
+
+        return static_cast<Property<tClass, tProperty> *>( mProperties[it->second] );
     }
 
     template<typename tProperty>
     Property< tClass, tProperty> *Get( size_t index ) const
     {
-        Property<tClass, tProperty> *property = static_cast<Property<tClass, tProperty> *>( mPropertyIndices.at( index ) );
+        const uint32_t key = static_cast< uint32_t >( index );
+        auto it = std::lower_bound( mPropertyIndices.begin(), mPropertyIndices.end(), key, LessKey() );
+
+        if ( it == mPropertyIndices.end() || it->first != key )
+        {
+            throw std::out_of_range( "No property is registered with the index." );
+        }
+
+        Property<tClass, tProperty> *property = static_cast<Property<tClass, tProperty> *>( mProperties[it->second] );
         assert( property->GetType() == std::type_index( typeid( tProperty ) ) );
         return property;
     }
 
+    using AbstractProperties::GetTypedView;
+
     template<typename tProperty>
     std::vector<Property<tClass, tProperty> *> GetAll() const
     {
-        std::vector<Property<tClass, tProperty> *> properties = GetBaseClassProperties< tProperty >();
+        const ArrayView<AbstractProperty *> typed = GetTypedView<tProperty>();
 
-        for ( const auto &property : mProperties )
+        std::vector<Property<tClass, tProperty> *> properties;
+        properties.reserve( typed.size() );
+
+        for ( AbstractProperty *property : typed )
         {
-            if ( property.second->GetType() == std::type_index( typeid( tProperty ) ) )
-            {
-                properties.push_back( static_cast<Property<tClass, tProperty> *>( property.second ) );
-            }
+            properties.push_back( static_cast<Property<tClass, tProperty> *>( property ) );
         }
 
         return properties;
     }
 
-    template<typename tProperty>
-    std::vector<Property<tClass, tProperty> *> GetAll( Accessibility accessibility,
-                                                       AccessibilityType type = AccessibilityType::DownTo ) const
+    ArrayView<AbstractProperty *> GetView() const override
+    {
+        return mAllProperties;
+    }
+
+    ArrayView<AbstractProperty *> GetDeclaredView() const override
+    {
+        return mProperties;
+    }
+
+    AbstractProperty *FindByIndex( size_t index ) const override
     {
-        std::vector<Property<tClass, tProperty> *> properties = GetBaseClassProperties< tProperty >();
+        if ( index < mIndexTable.size() )
+        {
+            return mIndexTable[index];
+        }
 
-        for ( const auto &property : mProperties )
+        if ( !mIndexTable.empty() || index > UINT32_MAX )
         {
-            if ( property.second->GetType() == std::type_index( typeid( tProperty ) ) &&
-                    IsCorrectAccessibilityType( property.second, accessibility, type ) )
-            {
-                properties.push_back( static_cast<Property<tClass, tProperty> *>( property.second ) );
-            }
+            return nullptr;
         }
 
-        return properties;
+        const uint32_t key = static_cast< uint32_t >( index );
+        auto it = std::lower_bound( mPropertyIndices.begin(), mPropertyIndices.end(), key, LessKey() );
+
+        return it != mPropertyIndices.end() && it->first == key ? mProperties[it->second] : nullptr;
     }
 
-    std::vector<AbstractProperty *> GetAll() const override
+    ArrayView<AbstractProperty *> GetNamedView() const override
+    {
+        return mNamedProperties;
+    }
+
+    ArrayView<AbstractProperty *> GetFlaggedView( uint32_t flag ) const override
+    {
+        assert( flag != 0 && ( flag & ( flag - 1 ) ) == 0 && "Only a single custom flag can be viewed." );
+
+        const uint32_t bit = ReflectionHelper::CountTrailingZeros( flag );
+        AbstractProperty *const *flagged = mFlaggedProperties.data();
+
+        return ArrayView<AbstractProperty *>( flagged + mFlagOffsets[bit], flagged + mFlagOffsets[bit + 1] );
+    }
+
+    ArrayView<AbstractProperty *> GetAccessibleView( Accessibility accessibility,
+                                                    AccessibilityType type = AccessibilityType::DownTo ) const override
     {
-        std::vector<AbstractProperty *> properties = GetBaseClassProperties();
+        return GetAccessibleRange( mAccessibleProperties, mAccessibleOffsets, accessibility, type );
+    }
+
+    ArrayView<AbstractProperty *> GetTypedView( const ValueType &type ) const override
+    {
+        auto it = std::lower_bound( mTypeOffsets.begin(), mTypeOffsets.end(), &type, LessType() );
 
-        for ( const auto &property : mProperties )
+        if ( it == mTypeOffsets.end() || it->first != &type )
         {
-            properties.push_back( property.second );
+            return ArrayView<AbstractProperty *>();
         }
 
-        return properties;
+        AbstractProperty *const *typed = mTypedProperties.data();
+        const size_t end = it + 1 != mTypeOffsets.end() ? ( it + 1 )->second : mTypedProperties.size();
+
+        return ArrayView<AbstractProperty *>( typed + it->second, typed + end );
     }
 
-    std::vector<AbstractProperty *> GetAll( Accessibility accessibility,
-                                            AccessibilityType type = AccessibilityType::DownTo ) const override
+    ArrayView<AbstractProperty *> GetTypedView( const ValueType &type, Accessibility accessibility,
+                                                AccessibilityType accessibilityType ) const override
     {
-        std::vector<AbstractProperty *> properties = GetBaseClassProperties();
+        auto it = std::lower_bound( mTypeOffsets.begin(), mTypeOffsets.end(), &type, LessType() );
 
-        for ( const auto &property : mProperties )
+        if ( it == mTypeOffsets.end() || it->first != &type )
         {
-            if ( IsCorrectAccessibilityType( property.second, accessibility, type ) )
-            {
-                properties.push_back( property.second );
-            }
+            return ArrayView<AbstractProperty *>();
         }
 
-        return properties;
+        return GetAccessibleRange( mTypedAccessibleProperties, mTypedAccessibleOffsets[it - mTypeOffsets.begin()],
+                                   accessibility, accessibilityType );
+    }
+
+    AbstractProperty *FindByName( std::string_view name ) const override
+    {
+        AbstractProperty *const *property = mNameIndex.Find( name );
+
+        return property ? *property : nullptr;
+    }
+
+    std::vector<AbstractProperty *> GetAll() const override
+    {
+        return mAllProperties;
+    }
+
+    std::vector<AbstractProperty *> GetAll( Accessibility accessibility,
+                                            AccessibilityType type = AccessibilityType::DownTo ) const override
+    {
+        return GetAccessibleView( accessibility, type ).ToVector();
     }
 
     std::set<std::string> GetNames() const override
     {
-        std::set<std::string> names = GetBaseClassNames();
+        std::set<std::string> names;
 
-        for ( const auto &name : mPropertyNames )
+        for ( AbstractProperty *property : mAllProperties )
         {
-            names.insert( name.first );
+            if ( property->GetCName() && strcmp( property->GetCName(), "" ) != 0 )
+            {
+                names.insert( property->GetCName() );
+            }
         }
 
         return names;
@@ -205,36 +347,214 @@ protected:
     {
         static_assert( sizeof( variable ) <= REFLECTION_MAX_MEMBER_PTR_SIZE,
                        "It seems the member pointer is greater than we did expect, please adjust the maximum member ptr size." );
+        assert( !mStorage && "Properties cannot be added after the type is finalised." );
 
         Property<tClass2, tProperty> *property = new Property<tClass2, tProperty>( variable, accessibility, name,
                                                                                    description, customFlags, index );
 
-        mProperties.insert( std::make_pair( MemberPtrToArray( variable ), property ) );
+        const uint32_t position = static_cast< uint32_t >( mProperties.size() );
+        mProperties.push_back( property );
+
+        const bool isUnique = Insert( mPropertyMemberPtrs, MemberPtrToArray( variable ), position, LessKey() );
+        assert( isUnique && "The member pointer is already registered." );
+        ( void )isUnique;
 
-        mPropertyIndices[index] = property;
+        Insert( mPropertyIndices, static_cast< uint32_t >( index ), position, LessKey() );
 
         if ( name != nullptr && strcmp( name, "" ) != 0 )
         {
-            mPropertyNames[name] = property;
+            Insert( mPropertyNames, name, position, LessName() );
         }
 
         return property;
     }
 
-    std::vector<AbstractProperty *> GetProperties() const
+    // Moves the own and inherited records into one allocation, the inherited records are copies that already
+    // include the offset of their base class, so queries never have to visit the base classes
+    void Finalize()
     {
-        std::vector<AbstractProperty *> properties = GetBaseClassProperties();
+        if ( mStorage )
+        {
+            return;
+        }
 
-        for ( const auto &property : mProperties )
+        size_t size = 0;
+
+        for ( const ITypeDescription::BaseClass &base : mType->GetBaseClasses() )
         {
-            properties.push_back( property.second );
+            for ( AbstractProperty *property : base.type->GetProperties()->GetView() )
+            {
+                size += AlignStorage( property->GetStorageSize() );
+            }
         }
 
-        return properties;
+        for ( AbstractProperty *property : mProperties )
+        {
+            size += AlignStorage( property->GetStorageSize() );
+        }
+
+        if ( size == 0 )
+        {
+            return;
+        }
+
+        mStorage = static_cast< uint8_t * >( ::operator new( size ) );
+
+        size_t offset = 0;
+
+        for ( const ITypeDescription::BaseClass &base : mType->GetBaseClasses() )
+        {
+            for ( AbstractProperty *property : base.type->GetProperties()->GetView() )
+            {
+                mAllProperties.push_back( property->CloneInto( mStorage + offset, base.offset ) );
+                offset += AlignStorage( property->GetStorageSize() );
+            }
+        }
+
+        // the lookup tables store positions, so they stay valid
+        for ( AbstractProperty *&property : mProperties )
+        {
+            AbstractProperty *staged = property;
+
+            property = staged->CloneInto( mStorage + offset, 0 );
+            offset += AlignStorage( staged->GetStorageSize() );
+
+            delete staged;
+        }
+
+        mAllProperties.insert( mAllProperties.end(), mProperties.begin(), mProperties.end() );
+
+        if ( !mPropertyIndices.empty() && mPropertyIndices.back().first < REFLECTION_MAX_DENSE_INDEX )
+        {
+            mIndexTable.resize( mPropertyIndices.back().first + 1, nullptr );
+
+            for ( const auto &index : mPropertyIndices )
+            {
+                mIndexTable[index.first] = mProperties[index.second];
+            }
+        }
+
+        // a declared property hides an inherited property with the same name
+        std::vector< std::pair< std::string_view, AbstractProperty * > > names;
+
+        for ( auto it = mAllProperties.rbegin(); it != mAllProperties.rend(); ++it )
+        {
+            const char *name = ( *it )->GetCName();
+
+            auto isNamed = [name]( const std::pair< std::string_view, AbstractProperty * > &entry )
+            {
+                return entry.first == name;
+            };
+
+            if ( name && *name && std::none_of( names.begin(), names.end(), isNamed ) )
+            {
+                names.emplace_back( name, *it );
+            }
+        }
+
+        mNameIndex.Build( names );
+
+        mNamedProperties.clear();
+
+        for ( auto it = names.rbegin(); it != names.rend(); ++it )
+        {
+            mNamedProperties.push_back( it->second );
+        }
+
+        // the properties with each custom flag, one range per bit
+        for ( uint32_t bit = 0; bit < 32; ++bit )
+        {
+            for ( AbstractProperty *property : mAllProperties )
+            {
+                if ( property->GetCustomFlags() & ( 1u << bit ) )
+                {
+                    mFlaggedProperties.push_back( property );
+                }
+            }
+
+            mFlagOffsets[bit + 1] = static_cast< uint32_t >( mFlaggedProperties.size() );
+        }
+
+        // the properties grouped by accessibility, with the public and protected groups repeated after the private
+        // group so that every accessibility query, including NotEqual, is a single range
+        for ( uint32_t level = 0; level < 5; ++level )
+        {
+            for ( AbstractProperty *property : mAllProperties )
+            {
+                if ( static_cast< uint32_t >( property->GetAccessibility() ) == level % 3 )
+                {
+                    mAccessibleProperties.push_back( property );
+                }
+            }
+
+            mAccessibleOffsets[level + 1] = static_cast< uint32_t >( mAccessibleProperties.size() );
+        }
+
+        // the properties grouped by value type, the value types are unique so their addresses are the keys
+        mTypedProperties = mAllProperties;
+
+        std::stable_sort( mTypedProperties.begin(), mTypedProperties.end(),
+                          []( const AbstractProperty *a, const AbstractProperty *b )
+        {
+            return std::less< const ValueType * >()( &a->GetValueType(), &b->GetValueType() );
+        } );
+
+        for ( size_t i = 0; i < mTypedProperties.size(); ++i )
+        {
+            const ValueType *valueType = &mTypedProperties[i]->GetValueType();
+
+            if ( mTypeOffsets.empty() || mTypeOffsets.back().first != valueType )
+            {
+                mTypeOffsets.emplace_back( valueType, static_cast< uint32_t >( i ) );
+            }
+        }
+
+        // the properties of each value type grouped by accessibility, in the same layout as mAccessibleProperties
+        for ( const auto &typeOffset : mTypeOffsets )
+        {
+            std::array<uint32_t, 6> offsets;
+            offsets[0] = static_cast< uint32_t >( mTypedAccessibleProperties.size() );
+
+            for ( uint32_t level = 0; level < 5; ++level )
+            {
+                for ( AbstractProperty *property : GetTypedView( *typeOffset.first ) )
+                {
+                    if ( static_cast< uint32_t >( property->GetAccessibility() ) == level % 3 )
+                    {
+                        mTypedAccessibleProperties.push_back( property );
+                    }
+                }
+
+                offsets[level + 1] = static_cast< uint32_t >( mTypedAccessibleProperties.size() );
+            }
+
+            mTypedAccessibleOffsets.push_back( offsets );
+        }
+    }
+
+    template< class tClass2, typename tProperty, typename tAttribute >
+    void AddAttribute( tProperty tClass2::*variable, tAttribute &&attribute )
+    {
+        typedef typename std::decay< tAttribute >::type tValue;
+
+        assert( !mStorage && "Attributes cannot be added after the type is finalised." );
+
+        AbstractProperty *property = GetByMemberPtr( variable );
+        assert( !property->template GetAttribute< tValue >() && "The property already has an attribute of the type." );
+
+        property->mAttributes.push_back( { ReflectionHelper::TypeID< tValue >::value,
+                                           std::make_shared< const tValue >( std::forward< tAttribute >( attribute ) ) } );
+    }
+
+    std::vector<AbstractProperty *> GetProperties() const
+    {
+        return GetAll();
     }
 
 private:
 
+    typedef std::array<uint8_t, REFLECTION_MAX_MEMBER_PTR_SIZE> MemberPtrArray;
+
     template<typename tProperty>
     union MemberPtr
     {
@@ -242,106 +562,153 @@ private:
         tProperty tClass::*memberPtr;
     };
 
-    std::map<std::array<uint8_t, REFLECTION_MAX_MEMBER_PTR_SIZE>, AbstractProperty *> mProperties;
-    std::map<std::string, AbstractProperty *> mPropertyNames;
-    std::map<uint32_t, AbstractProperty *> mPropertyIndices;
-
-    TypeDescription<tClass> *mType;
-
-    std::set<std::string> GetBaseClassNames() const
+    struct LessKey
     {
-        std::set<std::string> names;
-
-        for ( const TypeDescription<tClass> &parent : mType->GetBaseClasses() )
+        template< typename tKey >
+        bool operator()( const std::pair< tKey, uint32_t > &entry, const tKey &key ) const
         {
-            std::set<std::string> parentNames = parent->GetProperties()->GetNames();
-            names.insert( parentNames.begin(), parentNames.end() );
+            return entry.first < key;
         }
 
-        return names;
-    }
+        template< typename tKey >
+        bool operator()( const tKey &key, const std::pair< tKey, uint32_t > &entry ) const
+        {
+            return key < entry.first;
+        }
+    };
 
-    std::vector<AbstractProperty *> GetBaseClassProperties() const
+    struct LessType
     {
-        std::vector<AbstractProperty *> properties;
-
-        for ( const TypeDescription<tClass> &parent : mType->GetBaseClasses() )
+        bool operator()( const std::pair< const ValueType *, uint32_t > &entry, const ValueType *key ) const
         {
-            std::vector<AbstractProperty *> parentProperties = parent->GetProperties()->GetAll();
-            properties.insert( properties.end(), parentProperties.begin(), parentProperties.end() );
+            return std::less< const ValueType * >()( entry.first, key );
         }
+    };
 
-        return properties;
-    }
-
-    template<typename tProperty>
-    std::vector<Property<tClass, tProperty> * > GetBaseClassProperties() const
+    struct LessName
     {
-        std::vector<Property<tClass, tProperty> *> properties;
+        bool operator()( const std::pair< const char *, uint32_t > &entry, const char *key ) const
+        {
+            return strcmp( entry.first, key ) < 0;
+        }
 
-        for ( const TypeDescription<tClass> &parent : mType->GetBaseClasses() )
+        bool operator()( const char *key, const std::pair< const char *, uint32_t > &entry ) const
         {
-            std::vector<Property<tClass, tProperty> *> parentProperties = parent->GetProperties()->GetAll<tProperty>();
-            properties.insert( properties.end(), parentProperties.begin(), parentProperties.end() );
+            return strcmp( key, entry.first ) < 0;
         }
+    };
 
-        return properties;
-    }
+    // The records in declaration order, all in mStorage once the type is finalised
+    std::vector<AbstractProperty *> mProperties;
 
-    template< class tClass2, typename tProperty, typename = typename std::enable_if< std::is_class<tClass2>::value >::type >
-    static inline std::array<uint8_t, REFLECTION_MAX_MEMBER_PTR_SIZE> MemberPtrToArray( tProperty tClass2::* variable )
-    {
-        MemberPtr<tProperty> ptr = {};
-        ptr.memberPtr = variable;
+    // The inherited records followed by mProperties, built when the type is finalised
+    std::vector<AbstractProperty *> mAllProperties;
 
-        std::array<uint8_t, REFLECTION_MAX_MEMBER_PTR_SIZE> array;
-        std::copy( std::begin( ptr.data ), std::end( ptr.data ), std::begin( array ) );
+    // Sorted lookup tables that map to a position in mProperties
+    std::vector<std::pair<MemberPtrArray, uint32_t>> mPropertyMemberPtrs;
+    std::vector<std::pair<const char *, uint32_t>> mPropertyNames;
+    std::vector<std::pair<uint32_t, uint32_t>> mPropertyIndices;
 
-        return array;
-    }
+    // The declared records by index, when the indices are small enough for a dense table
+    std::vector<AbstractProperty *> mIndexTable;
+
+    // All named records by name
+    NameIndex<AbstractProperty *> mNameIndex;
+    std::vector<AbstractProperty *> mNamedProperties;
 
-    static bool IsCorrectAccessibilityType( AbstractProperty *property, Accessibility accessibility,
-                                            AccessibilityType type )
+    // All records by custom flag, those with bit i are found from mFlagOffsets[i] up to mFlagOffsets[i + 1]
+    std::vector<AbstractProperty *> mFlaggedProperties;
+    std::array<uint32_t, 33> mFlagOffsets;
+
+    // All records by accessibility as public, protected, private, public, protected, where group i starts at
+    // mAccessibleOffsets[i]
+    std::vector<AbstractProperty *> mAccessibleProperties;
+    std::array<uint32_t, 6> mAccessibleOffsets;
+
+    // All records by value type, sorted by the address of the value type, each group starts at its offset in
+    // mTypeOffsets and ends where the next one starts
+    std::vector<AbstractProperty *> mTypedProperties;
+    std::vector<std::pair<const ValueType *, uint32_t>> mTypeOffsets;
+
+    // The records of each value type by accessibility, laid out like mAccessibleProperties, where the groups of the
+    // value type at position i in mTypeOffsets start at mTypedAccessibleOffsets[i]
+    std::vector<AbstractProperty *> mTypedAccessibleProperties;
+    std::vector<std::array<uint32_t, 6>> mTypedAccessibleOffsets;
+
+    uint8_t *mStorage;
+
+    TypeDescription<tClass> *mType;
+
+    // The range of an accessibility query in records grouped as public, protected, private, public, protected
+    static ArrayView<AbstractProperty *> GetAccessibleRange( const std::vector<AbstractProperty *> &properties,
+                                                             const std::array<uint32_t, 6> &offsets,
+                                                             Accessibility accessibility, AccessibilityType type )
     {
+        const size_t level = static_cast< size_t >( accessibility );
+        assert( level < 3 && "Unknown accessibility." );
+
+        size_t begin = offsets[0];
+        size_t end = offsets[0];
+
         switch ( type )
         {
         case AccessibilityType::UpTo:
-
-            if ( property->GetAccessibility() >= accessibility )
-            {
-                return true;
-            }
-
+            begin = offsets[level];
+            end = offsets[3];
             break;
 
         case AccessibilityType::DownTo:
-            if ( property->GetAccessibility() <= accessibility )
-            {
-                return true;
-            }
-
+            end = offsets[level + 1];
             break;
 
         case AccessibilityType::Exclusive:
-            if ( property->GetAccessibility() == accessibility )
-            {
-                return true;
-            }
-
+            begin = offsets[level];
+            end = offsets[level + 1];
             break;
 
         case AccessibilityType::NotEqual:
+            begin = offsets[level + 1];
+            end = offsets[level + 3];
+            break;
+        }
 
-            if ( property->GetAccessibility() != accessibility )
-            {
-                return true;
-            }
+        AbstractProperty *const *records = properties.data();
 
-            break;
+        return ArrayView<AbstractProperty *>( records + begin, records + end );
+    }
+
+    static size_t AlignStorage( size_t size )
+    {
+        return ( size + alignof( std::max_align_t ) - 1 ) & ~( alignof( std::max_align_t ) - 1 );
+    }
 
+    // Inserts or replaces the key in the sorted table, returns whether the key was new
+    template< typename tKey, typename tLess >
+    static bool Insert( std::vector< std::pair< tKey, uint32_t > > &table, const tKey &key, uint32_t position,
+                        tLess less )
+    {
+        auto it = std::lower_bound( table.begin(), table.end(), key, less );
+
+        if ( it != table.end() && !less( key, *it ) )
+        {
+            it->second = position;
+            return false;
         }
 
-        return false;
+        table.insert( it, std::make_pair( key, position ) );
+        return true;
+    }
+
+    template< class tClass2, typename tProperty, typename = typename std::enable_if< std::is_class<tClass2>::value >::type >
+    static inline std::array<uint8_t, REFLECTION_MAX_MEMBER_PTR_SIZE> MemberPtrToArray( tProperty tClass2::* variable )
+    {
+        MemberPtr<tProperty> ptr = {};
+        ptr.memberPtr = variable;
+
+        std::array<uint8_t, REFLECTION_MAX_MEMBER_PTR_SIZE> array;
+        std::copy( std::begin( ptr.data ), std::end( ptr.data ), std::begin( array ) );
+
+        return array;
     }
 
 };
@@ -361,15 +728,17 @@ public:
         NoParent = -1
     };
 
+    // The flags that follow from the traits of the type
+    static constexpr uint32_t Flags = ReflectionHelper::GetTypeFlags< tClass >();
+
     TypeDescription()
         : mProperties( nullptr ),
+          mBaseClassCount( 0 ),
           mDescription( nullptr ),
           mName( nullptr ),
-          mBaseClassIndex( NoParent ),
-          mFlags( 0 ),
-          mIsBaseClass( false )
+          mTypeID( ReflectionHelper::TypeID< tClass >::value ),
+          mFlags( Flags )
     {
-        SetFlags< tClass >();
         Helper< tClass, std::is_class< tClass >::value >::SetProperties( this );
     }
 
@@ -383,15 +752,15 @@ public:
         return this;
     }
 
+    // Base classes are referenced through the registered description, which is never a base class copy
     virtual bool IsBaseClass() const override
     {
-        return mIsBaseClass;
+        return false;
     }
 
     virtual int32_t GetBaseClassIndex() const override
     {
-        assert( mIsBaseClass );
-        return mBaseClassIndex;
+        return NoParent;
     }
 
     bool HasProperties() const
@@ -404,9 +773,19 @@ public:
         return mProperties;
     }
 
-    std::vector<TypeDescription<tClass>> GetBaseClasses() const
+    virtual const ValueType &GetValueType() const override
+    {
+        return ValueType::Get< tClass >();
+    }
+
+    virtual ArrayView<BaseClass> GetBaseClasses() const override
     {
-        return mBaseClasses;
+        return ArrayView<BaseClass>( mAncestors.data(), mAncestors.data() + mBaseClassCount );
+    }
+
+    virtual ArrayView<BaseClass> GetAncestors() const override
+    {
+        return mAncestors;
     }
 
     virtual std::string GetDescription() const override
@@ -439,32 +818,36 @@ public:
         return mName;
     }
 
-protected:
-
-    explicit TypeDescription( int32_t baseClassIndex )
-        : mProperties( nullptr ),
-          mDescription( nullptr ),
-          mName( nullptr ),
-          mBaseClassIndex( baseClassIndex ),
-          mFlags( 0 ),
-          mIsBaseClass( true )
+    virtual uint64_t GetTypeID() const override
     {
+        return mTypeID;
     }
 
-    template< typename tBaseClass >
-    TypeDescription Create( int32_t baseClassIndex )
+    virtual uint32_t GetFlags() const override
     {
-        TypeDescription description( baseClassIndex );
-        description.SetFlags< tBaseClass >();
-        Helper< tBaseClass, std::is_class< tBaseClass >::value >::SetProperties( &description );
-
-        return description;
+        return mFlags;
     }
 
+protected:
+
     template< typename tBaseClass >
-    void AddBaseClass( int32_t baseClassIndex )
+    void AddBaseClass( const TypeDescription< tBaseClass > *base, int32_t baseClassIndex )
     {
-        mBaseClasses.emplace_back( Create< tBaseClass >( baseClassIndex ) );
+        static_assert( std::is_base_of< tBaseClass, tClass >::value, "The class does not derive from the base class." );
+        static_assert( !ReflectionHelper::IsVirtualBaseOf< tBaseClass, tClass >::value,
+                       "Virtual base classes have no fixed offset and cannot be reflected." );
+
+        // a non virtual base class is found at the same offset in every object of the derived class
+        const ptrdiff_t offset = ReflectionHelper::BaseOffsetOf< tClass, tBaseClass >();
+
+        const BaseClass baseClass = { base, offset, baseClassIndex };
+        mAncestors.insert( mAncestors.begin() + mBaseClassCount++, baseClass );
+
+        for ( const BaseClass &ancestor : base->GetAncestors() )
+        {
+            const BaseClass indirect = { ancestor.type, offset + ancestor.offset, ancestor.index };
+            mAncestors.push_back( indirect );
+        }
     }
 
     void Declare( const char *name, const char *description ) override
@@ -473,6 +856,24 @@ protected:
         mName = name;
     }
 
+    void DeclareTypeID( uint64_t typeId ) override
+    {
+        mTypeID = typeId;
+    }
+
+    void Finalize() override
+    {
+        if ( mProperties )
+        {
+            mProperties->Finalize();
+
+            if ( !mProperties->GetView().empty() )
+            {
+                mFlags |= HasReflectedProperties;
+            }
+        }
+    }
+
     Properties<tClass> *GetProperties()
     {
         return mProperties;
@@ -509,45 +910,16 @@ private:
 
     Properties<tClass> *mProperties;
 
-    std::vector<TypeDescription<tClass>> mBaseClasses;
+    // The direct base classes, followed by their ancestors
+    std::vector<BaseClass> mAncestors;
+    size_t mBaseClassCount;
 
     const char *mDescription;
     const char *mName;
 
-    int32_t mBaseClassIndex;
+    uint64_t mTypeID;
+
     uint32_t mFlags;
-    bool mIsBaseClass;
-
-    template< typename tFlagClass >
-    void SetFlags()
-    {
-        mFlags = std::is_array< tFlagClass >::value ? Type::IsArray : 0x00 |
-                 std::is_class< tFlagClass >::value ? Type::IsClass : 0x00 |
-                 std::is_enum< tFlagClass >::value ? Type::IsEnum : 0x00 |
-                 std::is_floating_point< tFlagClass >::value ? Type::IsFloatingPoint : 0x00 |
-                 std::is_integral< tFlagClass >::value ? Type::IsIntegral : 0x00 |
-                 std::is_member_function_pointer< tFlagClass >::value ? Type::IsMemberFunctionPointer : 0x00 |
-                 std::is_member_object_pointer< tFlagClass >::value ? Type::IsMemberObjectPointer : 0x00 |
-                 std::is_pointer< tFlagClass >::value ? Type::IsPointer : 0x00 |
-                 std::is_union< tFlagClass >::value ? Type::IsUnion : 0x00 |
-                 std::is_arithmetic< tFlagClass >::value ? Type::IsArithmetic : 0x00 |
-                 std::is_compound< tFlagClass >::value ? Type::IsCompound : 0x00 |
-                 std::is_fundamental< tFlagClass >::value ? Type::IsFundamental : 0x00 |
-                 std::is_member_pointer< tFlagClass >::value ? Type::IsMemberPointer : 0x00 |
-                 std::is_object< tFlagClass >::value ? Type::IsClass : 0x00 |
-                 std::is_reference< tFlagClass >::value ? Type::IsReference : 0x00 |
-                 std::is_scalar< tFlagClass >::value ? Type::IsScalar : 0x00 |
-                 std::is_const< tFlagClass >::value ? Type::IsConst : 0x00 |
-                 std::is_empty< tFlagClass >::value ? Type::IsEmpty : 0x00 |
-                 std::is_literal_type< tFlagClass >::value ? Type::IsLiteral : 0x00 |
-                 std::is_pod< tFlagClass >::value ? Type::IsPOD : 0x00 |
-                 std::is_polymorphic< tFlagClass >::value ? Type::IsPolymorphic : 0x00 |
-                 std::is_signed< tFlagClass >::value ? Type::IsSigned : 0x00 |
-                 std::is_standard_layout< tFlagClass >::value ? Type::IsStandardLayout : 0x00 |
-                 std::is_trivial< tFlagClass>::value ? Type::IsTrivial : 0x00 |
-                 std::is_unsigned< tFlagClass>::value ? Type::IsUnsigned : 0x00 |
-                 std::is_volatile< tFlagClass >::value ? Type::IsVolatile : 0x00;
-    }
 };
 
 #endif
\ No newline at end of file
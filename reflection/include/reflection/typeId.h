@@ -0,0 +1,112 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_TYPEID_H__
+#define __REFLECTION_TYPEID_H__
+
+#include "reflection/defines.h"
+
+#include <string_view>
+#include <stdint.h>
+
+namespace ReflectionHelper
+{
+    // 64 bit FNV-1a, evaluated at compile time when possible
+    constexpr uint64_t HashString( std::string_view str )
+    {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+
+        for ( char c : str )
+        {
+            hash = ( hash ^ static_cast< uint8_t >( c ) ) * 0x100000001b3ULL;
+        }
+
+        return hash;
+    }
+
+    template< class tClass >
+    constexpr std::string_view TypeSignature()
+    {
+        return REFLECTION_FUNCTION_SIGNATURE;
+    }
+
+    // Cuts the type name out of the signature of TypeSignature< tClass >(), dropping the rest of the signature
+    constexpr std::string_view ExtractTypeName( std::string_view signature )
+    {
+#if defined( _MSC_VER )
+        const std::string_view prefixes[] = { "class ", "struct ", "union ", "enum " };
+        const size_t begin = signature.find( "TypeSignature<" ) + 14;
+        std::string_view name = signature.substr( begin, signature.rfind( ">(void)" ) - begin );
+
+        for ( std::string_view prefix : prefixes )
+        {
+            if ( name.substr( 0, prefix.size() ) == prefix )
+            {
+                name.remove_prefix( prefix.size() );
+            }
+        }
+
+        return name;
+#else
+        // GCC lists the typedefs of the signature after the template arguments
+        const size_t begin = signature.find( "tClass = " ) + 9;
+        const size_t end = signature.find( "; ", begin );
+
+        return signature.substr( begin, ( end != std::string_view::npos ? end : signature.rfind( ']' ) ) - begin );
+#endif
+    }
+
+    // The type name as spelled by the compiler, e.g. "Namespace::Class"
+    template< class tClass >
+    constexpr std::string_view TypeName()
+    {
+        return ExtractTypeName( TypeSignature< tClass >() );
+    }
+
+    /**
+     * Only the type name is hashed, so the hash is the same in every run and process, and does not depend on how
+     * the platform spells its typedefs. Compilers still spell some names differently, e.g. template arguments and
+     * anonymous namespaces, and same named types in anonymous namespaces of different translation units share a
+     * hash. A type ID that gets persisted should therefore be declared with Mirror::Reflect( name, typeId ).
+     */
+    template< class tClass >
+    constexpr uint64_t HashTypeName()
+    {
+        return HashString( TypeName< tClass >() );
+    }
+
+    template< class tClass >
+    struct TypeID
+    {
+        static constexpr uint64_t value = HashTypeName< tClass >();
+    };
+
+    template< class tClass >
+    constexpr uint64_t TypeID< tClass >::value;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,92 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_TYPETABLE_H__
+#define __REFLECTION_TYPETABLE_H__
+
+#include "reflection/abstract/ITypeDescription.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <array>
+
+#ifndef REFLECTION_TYPE_TABLE_CHUNK_BITS
+#   define REFLECTION_TYPE_TABLE_CHUNK_BITS 8
+#endif
+
+#ifndef REFLECTION_TYPE_TABLE_MAX_CHUNKS
+#   define REFLECTION_TYPE_TABLE_MAX_CHUNKS 4096
+#endif
+
+/**
+ * Type descriptions indexed directly by their dense class ID. The slots live in fixed size chunks that are never
+ * moved or freed before destruction, so the address of a slot stays valid and can be cached per type.
+ */
+class TypeTable
+{
+public:
+
+    enum
+    {
+        ChunkBits = REFLECTION_TYPE_TABLE_CHUNK_BITS,
+        ChunkSize = 1 << ChunkBits,
+        MaxChunks = REFLECTION_TYPE_TABLE_MAX_CHUNKS
+    };
+
+    TypeTable();
+
+    ~TypeTable();
+
+    TypeTable( const TypeTable & ) = delete;
+    TypeTable &operator=( const TypeTable & ) = delete;
+
+    ITypeDescription *Find( size_t classId ) const
+    {
+        const size_t chunk = classId >> ChunkBits;
+
+        if ( chunk >= MaxChunks || !mChunks[chunk] )
+        {
+            return nullptr;
+        }
+
+        return mChunks[chunk][classId & ( ChunkSize - 1 )];
+    }
+
+    // Returns the slot for the class ID, allocating its chunk when needed
+    ITypeDescription **GetSlot( size_t classId );
+
+    size_t GetCapacity() const;
+
+    void Clear();
+
+private:
+
+    std::array< ITypeDescription **, MaxChunks > mChunks;
+    size_t mChunkCount;
+};
+
+#endif
\ No newline at end of file
@@ -28,7 +28,147 @@
 #ifndef __REFLECTION_UTIL_H__
 #define __REFLECTION_UTIL_H__
 
+#include <stdint.h>
+#include <stddef.h>
+#include <type_traits>
+#include <utility>
 #include <array>
+#include <vector>
+
+#if defined( _MSC_VER )
+#   include <intrin.h>
+#endif
+
+// A non-owning view over a contiguous range of elements
+template< typename tT >
+class ArrayView
+{
+public:
+
+    typedef const tT *const_iterator;
+    typedef const tT *iterator;
+
+    ArrayView()
+        : mBegin( nullptr ),
+          mEnd( nullptr )
+    {
+    }
+
+    ArrayView( const tT *begin, const tT *end )
+        : mBegin( begin ),
+          mEnd( end )
+    {
+    }
+
+    ArrayView( const std::vector< tT > &vector )
+        : mBegin( vector.data() ),
+          mEnd( vector.data() + vector.size() )
+    {
+    }
+
+    const tT *begin() const
+    {
+        return mBegin;
+    }
+
+    const tT *end() const
+    {
+        return mEnd;
+    }
+
+    const tT *data() const
+    {
+        return mBegin;
+    }
+
+    size_t size() const
+    {
+        return static_cast< size_t >( mEnd - mBegin );
+    }
+
+    bool empty() const
+    {
+        return mBegin == mEnd;
+    }
+
+    const tT &operator[]( size_t index ) const
+    {
+        return mBegin[index];
+    }
+
+    std::vector< tT > ToVector() const
+    {
+        return std::vector< tT >( mBegin, mEnd );
+    }
+
+private:
+
+    const tT *mBegin;
+    const tT *mEnd;
+};
+
+namespace ReflectionHelper
+{
+    // The index of the lowest set bit of a mask that is not zero
+    inline uint32_t CountTrailingZeros( uint64_t mask )
+    {
+#if defined( _MSC_VER )
+        unsigned long index;
+        _BitScanForward64( &index, mask );
+        return index;
+#else
+        return static_cast< uint32_t >( __builtin_ctzll( mask ) );
+#endif
+    }
+
+    /**
+     * The byte offset of a data member, like offsetof but for a member pointer, and 0 for classes that are not
+     * standard layout since only those have a fixed offset. The address of an unconstructed buffer on the stack
+     * is only used for pointer arithmetic, the member itself is never accessed.
+     */
+    template< class tClass, typename tProperty >
+    uint32_t OffsetOf( tProperty tClass::*member )
+    {
+        if constexpr ( std::is_standard_layout< tClass >::value )
+        {
+            typename std::aligned_storage< sizeof( tClass ), alignof( tClass ) >::type storage;
+            const uint8_t *object = reinterpret_cast< const uint8_t * >( &storage );
+
+            return static_cast< uint32_t >( reinterpret_cast< const uint8_t * >(
+                                                &( reinterpret_cast< const tClass * >( object )->*member ) ) - object );
+        }
+        else
+        {
+            ( void )member;
+
+            return 0;
+        }
+    }
+
+    // The byte offset of a non virtual base class in the derived class, computed from an unconstructed buffer
+    template< class tClass, class tBase >
+    ptrdiff_t BaseOffsetOf()
+    {
+        typename std::aligned_storage< sizeof( tClass ), alignof( tClass ) >::type storage;
+        const uint8_t *object = reinterpret_cast< const uint8_t * >( &storage );
+
+        return reinterpret_cast< const uint8_t * >(
+                   static_cast< const tBase * >( reinterpret_cast< const tClass * >( object ) ) ) - object;
+    }
+
+    // A derived pointer cannot be static_cast from a virtual base class
+    template< class tBase, class tDerived, class = void >
+    struct IsVirtualBaseOf
+    {
+        static const bool value = std::is_base_of< tBase, tDerived >::value;
+    };
+
+    template< class tBase, class tDerived >
+    struct IsVirtualBaseOf< tBase, tDerived, decltype( static_cast< void >( static_cast< tDerived * >( std::declval< tBase * >() ) ) ) >
+    {
+        static const bool value = false;
+    };
+}
 
 namespace std
 {
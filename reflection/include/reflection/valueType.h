@@ -0,0 +1,368 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_VALUETYPE_H__
+#define __REFLECTION_VALUETYPE_H__
+
+#include <type_traits>
+#include <utility>
+#include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+#include <new>
+
+class ITypeDescription;
+
+template< class tClass >
+class TypeDescription;
+
+namespace Reflect
+{
+    template< class tClass >
+    const TypeDescription< tClass > *GetType();
+}
+
+// How the value of a property is laid out, as far as serialisation is concerned
+enum class ValueKind : uint8_t
+{
+    // Copied byte for byte
+    Trivial,
+
+    // A contiguous sequence of elements, such as std::string or std::vector
+    Sequence,
+
+    // A class whose reflected properties are visited in turn
+    Class,
+
+    // An address, which is meaningless outside of the process
+    Pointer,
+
+    Unsupported
+};
+
+// The arithmetic category of a value, so text formats know how to print and parse it
+enum class ScalarKind : uint8_t
+{
+    None,
+    Bool,
+    Char,
+    Signed,
+    Unsigned,
+    Float
+};
+
+/**
+ * Type erased operations on the values of a property type, so containers and serialisers can manage raw storage
+ * for properties without knowing their type. Operations the type does not support are left null.
+ */
+struct ValueType
+{
+    size_t size;
+    size_t alignment;
+    bool isTriviallyCopyable;
+    ValueKind kind;
+    ScalarKind scalar;
+
+    // Default constructs count values
+    void ( *construct )( void *values, size_t count );
+
+    // Destroys count values
+    void ( *destroy )( void *values, size_t count );
+
+    // Copy assigns a single value
+    void ( *copy )( void *destination, const void *source );
+
+    // Move assigns a single value
+    void ( *move )( void *destination, void *source );
+
+    // Move constructs count values into uninitialised storage and destroys the sources
+    void ( *relocate )( void *destination, void *source, size_t count );
+
+    // The element type, element count and elements of a sequence
+    const ValueType *element;
+    size_t ( *count )( const void *sequence );
+    const void *( *data )( const void *sequence );
+
+    // Resizes the sequence and returns its elements, reusing the existing capacity where possible
+    void *( *resize )( void *sequence, size_t count );
+
+    // The registered description of a class, also for trivially copyable classes, or of the class a pointer points to
+    const ITypeDescription *( *reflectedType )();
+
+    template< typename tValue >
+    static const ValueType &Get();
+};
+
+namespace ReflectionHelper
+{
+    template< typename tValue >
+    struct SequenceOperations
+    {
+        static const bool value = false;
+    };
+
+    template< typename tElement, typename tTraits, typename tAllocator >
+    struct SequenceOperations< std::basic_string< tElement, tTraits, tAllocator > >
+    {
+        typedef std::basic_string< tElement, tTraits, tAllocator > tSequence;
+        typedef tElement tElementType;
+
+        static const bool value = true;
+
+        static size_t Count( const void *sequence )
+        {
+            return static_cast< const tSequence * >( sequence )->size();
+        }
+
+        static const void *Data( const void *sequence )
+        {
+            return static_cast< const tSequence * >( sequence )->data();
+        }
+
+        static void *Resize( void *sequence, size_t count )
+        {
+            tSequence *string = static_cast< tSequence * >( sequence );
+            string->resize( count );
+
+            return &( *string )[0];
+        }
+    };
+
+    template< typename tElement, typename tAllocator >
+    struct SequenceOperations< std::vector< tElement, tAllocator > >
+    {
+        typedef std::vector< tElement, tAllocator > tSequence;
+        typedef tElement tElementType;
+
+        static const bool value = true;
+
+        static size_t Count( const void *sequence )
+        {
+            return static_cast< const tSequence * >( sequence )->size();
+        }
+
+        static const void *Data( const void *sequence )
+        {
+            return static_cast< const tSequence * >( sequence )->data();
+        }
+
+        static void *Resize( void *sequence, size_t count )
+        {
+            tSequence *vector = static_cast< tSequence * >( sequence );
+            vector->resize( count );
+
+            return vector->data();
+        }
+    };
+
+    // std::vector< bool > does not store its elements contiguously
+    template< typename tAllocator >
+    struct SequenceOperations< std::vector< bool, tAllocator > >
+    {
+        static const bool value = false;
+    };
+
+    template< typename tValue >
+    constexpr ValueKind GetValueKind()
+    {
+        return std::is_pointer< tValue >::value || std::is_member_pointer< tValue >::value ? ValueKind::Pointer :
+               std::is_trivially_copyable< tValue >::value ? ValueKind::Trivial :
+               SequenceOperations< tValue >::value ? ValueKind::Sequence :
+               std::is_class< tValue >::value ? ValueKind::Class :
+               ValueKind::Unsupported;
+    }
+
+    template< typename tValue, bool tIsEnum = std::is_enum< tValue >::value >
+    struct ArithmeticType
+    {
+        typedef tValue type;
+    };
+
+    template< typename tValue >
+    struct ArithmeticType< tValue, true >
+    {
+        typedef typename std::underlying_type< tValue >::type type;
+    };
+
+    template< typename tValue >
+    constexpr ScalarKind GetScalarKind()
+    {
+        typedef typename ArithmeticType< tValue >::type tArithmetic;
+
+        return std::is_same< tArithmetic, bool >::value ? ScalarKind::Bool :
+               std::is_same< tArithmetic, char >::value ? ScalarKind::Char :
+               std::is_floating_point< tArithmetic >::value ? ScalarKind::Float :
+               std::is_integral< tArithmetic >::value && std::is_signed< tArithmetic >::value ? ScalarKind::Signed :
+               std::is_integral< tArithmetic >::value ? ScalarKind::Unsigned :
+               ScalarKind::None;
+    }
+
+    template< typename tValue >
+    const ITypeDescription *GetReflectedType()
+    {
+        return Reflect::GetType< tValue >();
+    }
+
+    template< typename tValue >
+    constexpr const ITypeDescription *( *GetReflectedTypeFunction() )()
+    {
+        if constexpr ( std::is_class< tValue >::value && !SequenceOperations< tValue >::value )
+        {
+            return &GetReflectedType< tValue >;
+        }
+        else if constexpr ( std::is_pointer< tValue >::value &&
+                            std::is_class< typename std::remove_pointer< tValue >::type >::value )
+        {
+            return &GetReflectedType< typename std::remove_cv< typename std::remove_pointer< tValue >::type >::type >;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    template< typename tValue, bool tIsSequence = SequenceOperations< tValue >::value >
+    struct SequenceType
+    {
+        static const ValueType *GetElement()
+        {
+            return nullptr;
+        }
+
+        static constexpr size_t ( *count )( const void * ) = nullptr;
+        static constexpr const void *( *data )( const void * ) = nullptr;
+        static constexpr void *( *resize )( void *, size_t ) = nullptr;
+    };
+
+    template< typename tValue >
+    struct SequenceType< tValue, true >
+    {
+        typedef SequenceOperations< tValue > tOperations;
+
+        static const ValueType *GetElement()
+        {
+            return &ValueType::Get< typename tOperations::tElementType >();
+        }
+
+        static constexpr size_t ( *count )( const void * ) = &tOperations::Count;
+        static constexpr const void *( *data )( const void * ) = &tOperations::Data;
+        static constexpr void *( *resize )( void *, size_t ) = &tOperations::Resize;
+    };
+
+    template< typename tValue >
+    struct ValueOperations
+    {
+        static void Construct( void *values, size_t count )
+        {
+            if constexpr ( std::is_default_constructible< tValue >::value )
+            {
+                tValue *value = static_cast< tValue * >( values );
+
+                for ( size_t i = 0; i < count; ++i )
+                {
+                    new( value + i ) tValue();
+                }
+            }
+        }
+
+        static void Destroy( void *values, size_t count )
+        {
+            tValue *value = static_cast< tValue * >( values );
+
+            for ( size_t i = 0; i < count; ++i )
+            {
+                value[i].~tValue();
+            }
+        }
+
+        static void Copy( void *destination, const void *source )
+        {
+            if constexpr ( std::is_copy_assignable< tValue >::value )
+            {
+                *static_cast< tValue * >( destination ) = *static_cast< const tValue * >( source );
+            }
+        }
+
+        static void Move( void *destination, void *source )
+        {
+            if constexpr ( std::is_move_assignable< tValue >::value )
+            {
+                *static_cast< tValue * >( destination ) = std::move( *static_cast< tValue * >( source ) );
+            }
+        }
+
+        static void Relocate( void *destination, void *source, size_t count )
+        {
+            if constexpr ( std::is_trivially_copyable< tValue >::value )
+            {
+                memcpy( destination, source, count * sizeof( tValue ) );
+            }
+            else if constexpr ( std::is_move_constructible< tValue >::value )
+            {
+                tValue *to = static_cast< tValue * >( destination );
+                tValue *from = static_cast< tValue * >( source );
+
+                for ( size_t i = 0; i < count; ++i )
+                {
+                    new( to + i ) tValue( std::move( from[i] ) );
+                    from[i].~tValue();
+                }
+            }
+        }
+    };
+}
+
+template< typename tValue >
+const ValueType &ValueType::Get()
+{
+    typedef ReflectionHelper::ValueOperations< tValue > Operations;
+
+    static const ValueType type =
+    {
+        sizeof( tValue ),
+        alignof( tValue ),
+        std::is_trivially_copyable< tValue >::value,
+        ReflectionHelper::GetValueKind< tValue >(),
+        ReflectionHelper::GetScalarKind< tValue >(),
+        std::is_default_constructible< tValue >::value ? &Operations::Construct : nullptr,
+        &Operations::Destroy,
+        std::is_copy_assignable< tValue >::value ? &Operations::Copy : nullptr,
+        std::is_move_assignable< tValue >::value ? &Operations::Move : nullptr,
+        std::is_move_constructible< tValue >::value ? &Operations::Relocate : nullptr,
+        ReflectionHelper::SequenceType< tValue >::GetElement(),
+        ReflectionHelper::SequenceType< tValue >::count,
+        ReflectionHelper::SequenceType< tValue >::data,
+        ReflectionHelper::SequenceType< tValue >::resize,
+        ReflectionHelper::GetReflectedTypeFunction< tValue >()
+    };
+
+    return type;
+}
+
+#endif
\ No newline at end of file
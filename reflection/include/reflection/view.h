@@ -0,0 +1,215 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_VIEW_H__
+#define __REFLECTION_VIEW_H__
+
+#include "reflection/reflection.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+/**
+ * The header of a buffer of records that can be read in place. Every record is the in memory image of an object,
+ * so properties are found at their reflected offsets. Only the bytes of trivially copyable properties at a fixed
+ * offset are stored, all other bytes of a record are zero.
+ */
+struct ViewHeader
+{
+    enum
+    {
+        Magic = 0x57564652,
+        Version = 1,
+
+        // The records start at a cache line boundary
+        DataOffset = 64
+    };
+
+    uint32_t magic;
+    uint32_t version;
+    uint64_t typeId;
+    uint64_t layoutHash;
+    uint32_t recordSize;
+    uint32_t recordAlignment;
+    uint64_t count;
+    uint8_t reserved[24];
+};
+
+static_assert( sizeof( ViewHeader ) == ViewHeader::DataOffset, "The view header must fill the space before the records." );
+
+// A read only mapping of a whole file
+class MappedFile
+{
+public:
+
+    MappedFile();
+
+    explicit MappedFile( const char *path );
+
+    MappedFile( MappedFile &&other );
+
+    ~MappedFile();
+
+    MappedFile( const MappedFile & ) = delete;
+    MappedFile &operator=( const MappedFile & ) = delete;
+
+    bool Open( const char *path );
+
+    void Close();
+
+    bool IsOpen() const
+    {
+        return mData != nullptr;
+    }
+
+    const uint8_t *GetData() const
+    {
+        return mData;
+    }
+
+    size_t GetSize() const
+    {
+        return mSize;
+    }
+
+private:
+
+    const uint8_t *mData;
+    size_t mSize;
+};
+
+namespace ReflectionHelper
+{
+    // Identifies the stored properties by their index, offset and size
+    uint64_t GetLayoutHash( const ITypeDescription *type, size_t recordSize );
+
+    void WriteView( const ITypeDescription *type, const void *objects, size_t recordSize, size_t recordAlignment,
+                    size_t count, std::vector< uint8_t > &buffer );
+
+    // Checks the header and bounds of the buffer, returning its records or nullptr when they cannot be read
+    const uint8_t *ValidateView( const ITypeDescription *type, size_t recordSize, size_t recordAlignment,
+                                 const uint8_t *bytes, size_t size, size_t &count );
+}
+
+// Typed access to the records of a validated buffer, without copying
+template< class tClass >
+class ObjectView
+{
+public:
+
+    ObjectView()
+        : mRecords( nullptr ),
+          mCount( 0 )
+    {
+    }
+
+    ObjectView( const uint8_t *records, size_t count )
+        : mRecords( records ),
+          mCount( count )
+    {
+    }
+
+    bool IsValid() const
+    {
+        return mRecords != nullptr;
+    }
+
+    size_t size() const
+    {
+        return mCount;
+    }
+
+    bool empty() const
+    {
+        return mCount == 0;
+    }
+
+    // The record can be passed to the property interface as the object
+    const void *GetRecord( size_t index ) const
+    {
+        assert( index < mCount );
+        return mRecords + index * sizeof( tClass );
+    }
+
+    template< typename tProperty >
+    const tProperty &Get( size_t index, const AbstractProperty *property ) const
+    {
+        assert( property->HasOffset() && property->GetValueType().kind == ValueKind::Trivial &&
+                "Only trivially copyable properties at a fixed offset are stored in a view." );
+
+        return property->At< tProperty >( GetRecord( index ) );
+    }
+
+    template< typename tProperty, class tOwner >
+    const tProperty &Get( size_t index, tProperty tOwner::*member ) const
+    {
+        static_assert( std::is_base_of< tOwner, tClass >::value, "The member does not belong to the class." );
+
+        return static_cast< const tClass * >( GetRecord( index ) )->*member;
+    }
+
+private:
+
+    const uint8_t *mRecords;
+    size_t mCount;
+};
+
+namespace Reflect
+{
+    template< class tClass >
+    inline void WriteView( const tClass *objects, size_t count, std::vector< uint8_t > &buffer )
+    {
+        ReflectionHelper::WriteView( GetType< tClass >(), objects, sizeof( tClass ), alignof( tClass ), count, buffer );
+    }
+
+    template< class tClass >
+    inline void WriteView( const std::vector< tClass > &objects, std::vector< uint8_t > &buffer )
+    {
+        WriteView( objects.data(), objects.size(), buffer );
+    }
+
+    // Validates the buffer once, after which its records are read in place; the view is invalid when it fails
+    template< class tClass >
+    inline ObjectView< tClass > View( const uint8_t *bytes, size_t size )
+    {
+        size_t count = 0;
+        const uint8_t *records = ReflectionHelper::ValidateView( GetType< tClass >(), sizeof( tClass ), alignof( tClass ),
+                                                                 bytes, size, count );
+
+        return records ? ObjectView< tClass >( records, count ) : ObjectView< tClass >();
+    }
+
+    template< class tClass >
+    inline ObjectView< tClass > View( const MappedFile &file )
+    {
+        return View< tClass >( file.GetData(), file.GetSize() );
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,192 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#pragma once
+#ifndef __REFLECTION_VISITOR_H__
+#define __REFLECTION_VISITOR_H__
+
+#include "reflection/accessibility.h"
+
+#include <type_traits>
+#include <utility>
+#include <stdint.h>
+#include <stddef.h>
+
+// The declaration of a property as seen by a static visitor
+struct StaticProperty
+{
+    size_t index;
+    const char *name;
+    const char *description;
+    Accessibility accessibility;
+    uint32_t customFlags;
+};
+
+namespace ReflectionHelper
+{
+    template< class tObject, class tVisitor >
+    class VisitingMirror;
+
+    // Whether the class declares its properties as template< class tMirror > static void Reflect( tMirror & )
+    template< class tClass, class = void >
+    struct HasStaticReflect
+        : std::false_type
+    {
+    };
+
+    template< class tClass >
+    struct HasStaticReflect< tClass, decltype( tClass::Reflect( std::declval< VisitingMirror< tClass, int > & >() ) ) >
+        : std::true_type
+    {
+    };
+
+    /**
+     * Replays the Reflect declarations of a class on an object, calling the visitor with a reference to every
+     * property value. Since the member pointers are constants in the declarations, the calls are inlined without
+     * any virtual dispatch or registry access.
+     */
+    template< class tObject, class tVisitor >
+    class VisitingMirror
+    {
+    public:
+
+        VisitingMirror( tObject &object, tVisitor &visitor )
+            : mObject( object ),
+              mVisitor( visitor )
+        {
+        }
+
+        void Reflect( const char * = nullptr,
+                      const char * = nullptr )
+        {
+        }
+
+        void Reflect( const char *,
+                      uint64_t,
+                      const char * = nullptr )
+        {
+        }
+
+        template< class tClass, class tProperty >
+        void Reflect( tProperty tClass::*variable,
+                      size_t index,
+                      const char *name = nullptr,
+                      const char *description = nullptr )
+        {
+            Visit( variable, { index, name, description, Accessibility::Public, 0x00 } );
+        }
+
+        template< class tClass, class tProperty >
+        void Reflect( tProperty tClass::*variable,
+                      size_t index,
+                      Accessibility accessibility,
+                      const char *name = nullptr,
+                      const char *description = nullptr )
+        {
+            Visit( variable, { index, name, description, accessibility, 0x00 } );
+        }
+
+        template< class tClass, class tProperty >
+        void Reflect( tProperty tClass::*variable,
+                      uint32_t index,
+                      Accessibility accessibility,
+                      uint32_t customFlags,
+                      const char *name = nullptr,
+                      const char *description = nullptr )
+        {
+            Visit( variable, { index, name, description, accessibility, customFlags } );
+        }
+
+        template< class tClass, class tProperty >
+        void Reflect( tProperty tClass::*variable,
+                      size_t index,
+                      uint32_t customFlags,
+                      Accessibility accessibility = Accessibility::Public,
+                      const char *name = nullptr,
+                      const char *description = nullptr )
+        {
+            Visit( variable, { index, name, description, accessibility, customFlags } );
+        }
+
+        template< class tClass, class tProperty >
+        void Reflect( tProperty tClass::*variable,
+                      uint32_t index,
+                      uint32_t customFlags,
+                      const char *name = nullptr,
+                      const char *description = nullptr )
+        {
+            Visit( variable, { index, name, description, Accessibility::Public, customFlags } );
+        }
+
+        // Attributes only live in the registry, the visitor sees the declarations themselves
+        template< class tClass, class tProperty, class tAttribute >
+        void Attribute( tProperty tClass::*,
+                        tAttribute && )
+        {
+        }
+
+        template< class tClass, class tBase >
+        void Reflect( uint32_t )
+        {
+            typedef typename std::conditional< std::is_const< tObject >::value, const tBase, tBase >::type tBaseObject;
+
+            static_assert( HasStaticReflect< tBase >::value,
+                           "The base class must declare template< class tMirror > static void Reflect( tMirror & )." );
+
+            VisitingMirror< tBaseObject, tVisitor > mirror( static_cast< tBaseObject & >( mObject ), mVisitor );
+            tBase::Reflect( mirror );
+        }
+
+    private:
+
+        tObject &mObject;
+        tVisitor &mVisitor;
+
+        template< class tClass, class tProperty >
+        void Visit( tProperty tClass::*variable, const StaticProperty &property )
+        {
+            mVisitor( mObject.*variable, property );
+        }
+    };
+}
+
+namespace Reflect
+{
+    // Calls visitor( value, property ) for every property in the order of the Reflect declarations of the class
+    template< class tClass, class tVisitor >
+    inline void ForEachProperty( tClass &object, tVisitor &&visitor )
+    {
+        typedef typename std::remove_const< tClass >::type tType;
+
+        static_assert( ReflectionHelper::HasStaticReflect< tType >::value,
+                       "ForEachProperty needs template< class tMirror > static void Reflect( tMirror & )." );
+
+        ReflectionHelper::VisitingMirror< tClass, typename std::remove_reference< tVisitor >::type > mirror( object, visitor );
+        tType::Reflect( mirror );
+    }
+}
+
+#endif
\ No newline at end of file
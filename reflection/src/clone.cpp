@@ -0,0 +1,125 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/clone.h"
+
+#include <assert.h>
+#include <string.h>
+
+namespace
+{
+    void CopyObject( const PlanOp *op, const PlanOp *end, uint8_t *destination, const uint8_t *source )
+    {
+        while ( op != end )
+        {
+            switch ( op->code )
+            {
+            case PlanOp::Code::Copy:
+                {
+                    // runs are only split by their custom flags, which do not matter for a copy
+                    const uint32_t offset = op->offset;
+                    uint32_t size = op->size;
+
+                    while ( ++op != end && op->code == PlanOp::Code::Copy && op->offset == offset + size )
+                    {
+                        size += op->size;
+                    }
+
+                    memcpy( destination + offset, source + offset, size );
+                }
+                continue;
+
+            case PlanOp::Code::Sequence:
+                if ( op->type->copy )
+                {
+                    op->type->copy( destination + op->offset, source + op->offset );
+                }
+                break;
+
+            case PlanOp::Code::Property:
+                if ( op->type->copy )
+                {
+                    op->type->copy( op->property->Get( destination + op->offset ),
+                                    op->property->Get( const_cast< uint8_t * >( source + op->offset ) ) );
+                }
+                break;
+
+            case PlanOp::Code::Pointer:
+                memcpy( destination + op->offset, source + op->offset, op->size );
+                break;
+            }
+
+            ++op;
+        }
+    }
+}
+
+void Reflect::CopyInto( const ITypeDescription *type, void *destination, const void *source )
+{
+    CopyInto( type, destination, source, 1 );
+}
+
+void Reflect::CopyInto( const ITypeDescription *type, void *destinations, const void *sources, size_t count )
+{
+    const ValueType &value = type->GetValueType();
+
+    if ( value.isTriviallyCopyable )
+    {
+        memcpy( destinations, sources, count * value.size );
+        return;
+    }
+
+    const ArrayView< PlanOp > ops = type->GetPlan().GetOps();
+    uint8_t *destination = static_cast< uint8_t * >( destinations );
+    const uint8_t *source = static_cast< const uint8_t * >( sources );
+
+    for ( size_t i = 0; i < count; ++i, destination += value.size, source += value.size )
+    {
+        CopyObject( ops.begin(), ops.end(), destination, source );
+    }
+}
+
+bool Reflect::CloneInto( const ITypeDescription *type, void *storage, const void *sources, size_t count )
+{
+    const ValueType &value = type->GetValueType();
+
+    if ( value.isTriviallyCopyable )
+    {
+        memcpy( storage, sources, count * value.size );
+        return true;
+    }
+
+    if ( !value.construct )
+    {
+        assert( false && "The type is not default constructible." );
+        return false;
+    }
+
+    value.construct( storage, count );
+    CopyInto( type, storage, sources, count );
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,238 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/compare.h"
+
+namespace
+{
+    uint64_t HashObject( const ITypeDescription *type, const uint8_t *object, uint32_t excludeFlags, uint64_t hash );
+
+    bool EqualObjects( const ITypeDescription *type, const uint8_t *left, const uint8_t *right, uint32_t excludeFlags );
+
+    // Whether the elements of a sequence are hashed and compared as a single block of bytes
+    bool IsDense( const ValueType &element, uint32_t excludeFlags )
+    {
+        if ( element.kind != ValueKind::Trivial )
+        {
+            return false;
+        }
+
+        if ( !TypePlan::IsInlined( element ) )
+        {
+            return true;
+        }
+
+        // an element without padding or excluded properties is a single copy
+        const TypePlan &plan = element.reflectedType()->GetPlan();
+
+        return plan.IsTrivial() && plan.GetCopySize() == element.size && ( plan.GetOps()[0].customFlags & excludeFlags ) == 0;
+    }
+
+    uint64_t HashValue( const ValueType &type, const void *value, uint32_t excludeFlags, uint64_t hash )
+    {
+        switch ( type.kind )
+        {
+        case ValueKind::Trivial:
+            if ( TypePlan::IsInlined( type ) )
+            {
+                return HashObject( type.reflectedType(), static_cast< const uint8_t * >( value ), excludeFlags, hash );
+            }
+
+            return ReflectionHelper::HashBlocks( value, type.size, hash );
+
+        case ValueKind::Sequence:
+            {
+                const ValueType &element = *type.element;
+                const size_t count = type.count( value );
+                const uint8_t *elements = static_cast< const uint8_t * >( type.data( value ) );
+
+                if ( IsDense( element, excludeFlags ) )
+                {
+                    return ReflectionHelper::HashBlocks( elements, count * element.size, hash );
+                }
+
+                // the count separates the elements of nested sequences
+                hash = ReflectionHelper::HashBytes( &count, sizeof( count ), hash );
+
+                for ( size_t i = 0; i < count; ++i )
+                {
+                    hash = HashValue( element, elements + i * element.size, excludeFlags, hash );
+                }
+
+                return hash;
+            }
+
+        case ValueKind::Class:
+            return HashObject( type.reflectedType(), static_cast< const uint8_t * >( value ), excludeFlags, hash );
+
+        case ValueKind::Pointer:
+            return ReflectionHelper::HashBytes( value, type.size, hash );
+
+        case ValueKind::Unsupported:
+            break;
+        }
+
+        return hash;
+    }
+
+    uint64_t HashObject( const ITypeDescription *type, const uint8_t *object, uint32_t excludeFlags, uint64_t hash )
+    {
+        for ( const PlanOp &op : type->GetPlan().GetOps() )
+        {
+            if ( op.customFlags & excludeFlags )
+            {
+                continue;
+            }
+
+            switch ( op.code )
+            {
+            case PlanOp::Code::Copy:
+                hash = ReflectionHelper::HashBlocks( object + op.offset, op.size, hash );
+                break;
+
+            case PlanOp::Code::Sequence:
+                hash = HashValue( *op.type, object + op.offset, excludeFlags, hash );
+                break;
+
+            case PlanOp::Code::Property:
+                hash = HashValue( *op.type, op.property->Get( const_cast< uint8_t * >( object + op.offset ) ), excludeFlags,
+                                  hash );
+                break;
+
+            case PlanOp::Code::Pointer:
+                hash = ReflectionHelper::HashBytes( object + op.offset, op.size, hash );
+                break;
+            }
+        }
+
+        return hash;
+    }
+
+    bool EqualValues( const ValueType &type, const void *left, const void *right, uint32_t excludeFlags )
+    {
+        switch ( type.kind )
+        {
+        case ValueKind::Trivial:
+            if ( TypePlan::IsInlined( type ) )
+            {
+                return EqualObjects( type.reflectedType(), static_cast< const uint8_t * >( left ),
+                                     static_cast< const uint8_t * >( right ), excludeFlags );
+            }
+
+            return memcmp( left, right, type.size ) == 0;
+
+        case ValueKind::Sequence:
+            {
+                const ValueType &element = *type.element;
+                const size_t count = type.count( left );
+
+                if ( count != type.count( right ) )
+                {
+                    return false;
+                }
+
+                const uint8_t *leftElements = static_cast< const uint8_t * >( type.data( left ) );
+                const uint8_t *rightElements = static_cast< const uint8_t * >( type.data( right ) );
+
+                if ( IsDense( element, excludeFlags ) )
+                {
+                    return count == 0 || memcmp( leftElements, rightElements, count * element.size ) == 0;
+                }
+
+                for ( size_t i = 0; i < count; ++i )
+                {
+                    if ( !EqualValues( element, leftElements + i * element.size, rightElements + i * element.size,
+                                       excludeFlags ) )
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+        case ValueKind::Class:
+            return EqualObjects( type.reflectedType(), static_cast< const uint8_t * >( left ),
+                                 static_cast< const uint8_t * >( right ), excludeFlags );
+
+        case ValueKind::Pointer:
+            return memcmp( left, right, type.size ) == 0;
+
+        case ValueKind::Unsupported:
+            break;
+        }
+
+        return true;
+    }
+
+    bool EqualObjects( const ITypeDescription *type, const uint8_t *left, const uint8_t *right, uint32_t excludeFlags )
+    {
+        for ( const PlanOp &op : type->GetPlan().GetOps() )
+        {
+            if ( op.customFlags & excludeFlags )
+            {
+                continue;
+            }
+
+            bool equal = true;
+
+            switch ( op.code )
+            {
+            case PlanOp::Code::Copy:
+            case PlanOp::Code::Pointer:
+                equal = memcmp( left + op.offset, right + op.offset, op.size ) == 0;
+                break;
+
+            case PlanOp::Code::Sequence:
+                equal = EqualValues( *op.type, left + op.offset, right + op.offset, excludeFlags );
+                break;
+
+            case PlanOp::Code::Property:
+                equal = EqualValues( *op.type, op.property->Get( const_cast< uint8_t * >( left + op.offset ) ),
+                                     op.property->Get( const_cast< uint8_t * >( right + op.offset ) ), excludeFlags );
+                break;
+            }
+
+            if ( !equal )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+uint64_t Reflect::Hash( const ITypeDescription *type, const void *object, uint32_t excludeFlags )
+{
+    return HashObject( type, static_cast< const uint8_t * >( object ), excludeFlags, 0 );
+}
+
+bool Reflect::Equal( const ITypeDescription *type, const void *left, const void *right, uint32_t excludeFlags )
+{
+    return EqualObjects( type, static_cast< const uint8_t * >( left ), static_cast< const uint8_t * >( right ),
+                         excludeFlags );
+}
\ No newline at end of file
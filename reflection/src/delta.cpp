@@ -0,0 +1,257 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/delta.h"
+
+#include <algorithm>
+
+namespace
+{
+    bool ObjectsEqual( const ITypeDescription *type, const uint8_t *left, const uint8_t *right )
+    {
+        for ( const PlanOp &op : type->GetPlan().GetOps() )
+        {
+            bool equal = true;
+
+            switch ( op.code )
+            {
+            case PlanOp::Code::Copy:
+                equal = memcmp( left + op.offset, right + op.offset, op.size ) == 0;
+                break;
+
+            case PlanOp::Code::Sequence:
+                equal = Reflect::ValuesEqual( *op.type, left + op.offset, right + op.offset );
+                break;
+
+            case PlanOp::Code::Property:
+                equal = Reflect::ValuesEqual( *op.type, op.property->Get( const_cast< uint8_t * >( left + op.offset ) ),
+                                              op.property->Get( const_cast< uint8_t * >( right + op.offset ) ) );
+                break;
+
+            case PlanOp::Code::Pointer:
+                break;
+            }
+
+            if ( !equal )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool BytesEqual( const uint8_t *left, const uint8_t *right, size_t size )
+    {
+        if ( size != 8 )
+        {
+            return memcmp( left, right, size ) == 0;
+        }
+
+        uint64_t leftWord;
+        uint64_t rightWord;
+        memcpy( &leftWord, left, 8 );
+        memcpy( &rightWord, right, 8 );
+
+        return leftWord == rightWord;
+    }
+
+    const void *GetValue( const AbstractProperty *property, const uint8_t *object )
+    {
+        return property->HasOffset() ? object + property->GetOffset() :
+               property->Get( const_cast< uint8_t * >( object ) );
+    }
+}
+
+bool Reflect::ValuesEqual( const ValueType &type, const void *left, const void *right )
+{
+    switch ( type.kind )
+    {
+    case ValueKind::Trivial:
+        return memcmp( left, right, type.size ) == 0;
+
+    case ValueKind::Sequence:
+        {
+            const ValueType &element = *type.element;
+            const size_t count = type.count( left );
+
+            if ( count != type.count( right ) )
+            {
+                return false;
+            }
+
+            const uint8_t *leftElements = static_cast< const uint8_t * >( type.data( left ) );
+            const uint8_t *rightElements = static_cast< const uint8_t * >( type.data( right ) );
+
+            if ( element.kind == ValueKind::Trivial )
+            {
+                return count == 0 || memcmp( leftElements, rightElements, count * element.size ) == 0;
+            }
+
+            for ( size_t i = 0; i < count; ++i )
+            {
+                if ( !ValuesEqual( element, leftElements + i * element.size, rightElements + i * element.size ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    case ValueKind::Class:
+        return ObjectsEqual( type.reflectedType(), static_cast< const uint8_t * >( left ),
+                             static_cast< const uint8_t * >( right ) );
+
+    case ValueKind::Pointer:
+    case ValueKind::Unsupported:
+        break;
+    }
+
+    // values the binary format does not write cannot change it
+    return true;
+}
+
+bool Reflect::WriteDelta( const ITypeDescription *type, const void *baseline, const void *current,
+                          BinaryWriter &writer )
+{
+    const uint8_t *before = static_cast< const uint8_t * >( baseline );
+    const uint8_t *after = static_cast< const uint8_t * >( current );
+
+    const ArrayView< PlanField > fields = type->GetPlan().GetFields();
+
+    std::vector< uint8_t > &buffer = writer.GetBuffer();
+    const size_t mask = buffer.size();
+    buffer.resize( mask + ( fields.size() + 7 ) / 8, 0 );
+
+    bool changed = false;
+
+    for ( size_t i = 0; i < fields.size(); )
+    {
+        const PlanField &field = fields[i];
+
+        if ( field.runEnd != 0 )
+        {
+            const size_t end = field.runEnd;
+            const uint32_t runEnd = fields[end - 1].offset + fields[end - 1].size;
+
+            // compare the run a word at a time, and only the fields overlapping a changed word by themselves
+            size_t changedField = i;
+
+            for ( uint32_t word = field.offset; word < runEnd; word += 8 )
+            {
+                const uint32_t wordSize = std::min< uint32_t >( 8, runEnd - word );
+
+                if ( BytesEqual( before + word, after + word, wordSize ) )
+                {
+                    continue;
+                }
+
+                while ( fields[changedField].offset + fields[changedField].size <= word )
+                {
+                    ++changedField;
+                }
+
+                for ( size_t j = changedField; j < end && fields[j].offset < word + wordSize; ++j )
+                {
+                    const uint32_t offset = fields[j].offset;
+                    const uint32_t size = fields[j].size;
+
+                    // a field that spans several words is written once
+                    if ( !( buffer[mask + j / 8] & ( 1 << ( j & 7 ) ) ) && !BytesEqual( before + offset, after + offset, size ) )
+                    {
+                        buffer[mask + j / 8] |= static_cast< uint8_t >( 1 << ( j & 7 ) );
+                        writer.Write( after + offset, size );
+                        changed = true;
+                    }
+                }
+            }
+
+            i = end;
+            continue;
+        }
+
+        const void *currentValue = GetValue( field.property, after );
+
+        if ( !ValuesEqual( *field.type, GetValue( field.property, before ), currentValue ) )
+        {
+            buffer[mask + i / 8] |= static_cast< uint8_t >( 1 << ( i & 7 ) );
+            SerializeValue( *field.type, currentValue, writer );
+            changed = true;
+        }
+
+        ++i;
+    }
+
+    return changed;
+}
+
+bool Reflect::ApplyDelta( const ITypeDescription *type, void *target, BinaryReader &reader )
+{
+    uint8_t *object = static_cast< uint8_t * >( target );
+
+    const ArrayView< AbstractProperty * > properties = type->GetProperties() ? type->GetProperties()->GetView() :
+                                                       ArrayView< AbstractProperty * >();
+
+    const size_t maskSize = ( properties.size() + 7 ) / 8;
+    const uint8_t *mask = reader.GetCursor();
+
+    if ( !reader.Skip( maskSize ) )
+    {
+        return false;
+    }
+
+    // bits past the last property belong to a different version of the type
+    if ( properties.size() % 8 != 0 && ( mask[maskSize - 1] >> ( properties.size() % 8 ) ) != 0 )
+    {
+        return false;
+    }
+
+    for ( size_t i = 0; i < properties.size(); ++i )
+    {
+        // a byte of unchanged properties is skipped at once
+        if ( mask[i / 8] == 0 )
+        {
+            i |= 7;
+            continue;
+        }
+
+        if ( !( mask[i / 8] & ( 1 << ( i & 7 ) ) ) )
+        {
+            continue;
+        }
+
+        const AbstractProperty *property = properties[i];
+        void *value = property->HasOffset() ? object + property->GetOffset() : property->Get( object );
+
+        if ( !DeserializeValue( property->GetValueType(), value, reader ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/gather.h"
+
+#include <string.h>
+
+#if defined( __AVX2__ ) || defined( __AVX512F__ )
+#   include <immintrin.h>
+#endif
+
+namespace
+{
+    template< typename tValue >
+    void GatherValues( const uint8_t *source, size_t stride, size_t count, tValue *output )
+    {
+        for ( size_t i = 0; i < count; ++i, source += stride )
+        {
+            memcpy( output + i, source, sizeof( tValue ) );
+        }
+    }
+
+    template< typename tValue >
+    void ScatterValues( const tValue *input, size_t count, uint8_t *destination, size_t stride )
+    {
+        for ( size_t i = 0; i < count; ++i, destination += stride )
+        {
+            memcpy( destination, input + i, sizeof( tValue ) );
+        }
+    }
+
+#if defined( __AVX2__ )
+
+    // The gather instructions take 32 bit byte offsets, so a group of lanes has to fit within 2GB
+    bool FitsGather( size_t stride, size_t lanes )
+    {
+        return stride * lanes <= INT32_MAX;
+    }
+
+    size_t Gather32( const uint8_t *&source, size_t stride, size_t count, uint32_t *output )
+    {
+        const int32_t step = static_cast< int32_t >( stride );
+        const __m256i offsets = _mm256_setr_epi32( 0, step, 2 * step, 3 * step, 4 * step, 5 * step, 6 * step, 7 * step );
+
+        size_t i = 0;
+
+        for ( ; i + 8 <= count; i += 8, source += 8 * stride )
+        {
+            const __m256i values = _mm256_i32gather_epi32( reinterpret_cast< const int * >( source ), offsets, 1 );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( output + i ), values );
+        }
+
+        return i;
+    }
+
+    size_t Gather64( const uint8_t *&source, size_t stride, size_t count, uint64_t *output )
+    {
+        const int32_t step = static_cast< int32_t >( stride );
+        const __m128i offsets = _mm_setr_epi32( 0, step, 2 * step, 3 * step );
+
+        size_t i = 0;
+
+        for ( ; i + 4 <= count; i += 4, source += 4 * stride )
+        {
+            const __m256i values = _mm256_i32gather_epi64( reinterpret_cast< const long long * >( source ), offsets, 1 );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( output + i ), values );
+        }
+
+        return i;
+    }
+
+#endif
+
+#if defined( __AVX512F__ )
+
+    size_t Scatter32( const uint32_t *input, size_t count, uint8_t *&destination, size_t stride )
+    {
+        const int32_t step = static_cast< int32_t >( stride );
+        const __m512i offsets = _mm512_mullo_epi32( _mm512_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ),
+                                                    _mm512_set1_epi32( step ) );
+
+        size_t i = 0;
+
+        for ( ; i + 16 <= count; i += 16, destination += 16 * stride )
+        {
+            const __m512i values = _mm512_loadu_si512( input + i );
+            _mm512_i32scatter_epi32( destination, offsets, values, 1 );
+        }
+
+        return i;
+    }
+
+#endif
+}
+
+void ReflectionHelper::GatherStrided( const void *source, size_t stride, size_t count, size_t size, void *output )
+{
+    const uint8_t *bytes = static_cast< const uint8_t * >( source );
+
+    if ( stride == size )
+    {
+        memcpy( output, bytes, count * size );
+        return;
+    }
+
+    switch ( size )
+    {
+    case 1:
+        GatherValues( bytes, stride, count, static_cast< uint8_t * >( output ) );
+        break;
+
+    case 2:
+        GatherValues( bytes, stride, count, static_cast< uint16_t * >( output ) );
+        break;
+
+    case 4:
+        {
+            uint32_t *values = static_cast< uint32_t * >( output );
+            size_t done = 0;
+#if defined( __AVX2__ )
+
+            if ( FitsGather( stride, 8 ) )
+            {
+                done = Gather32( bytes, stride, count, values );
+            }
+
+#endif
+            GatherValues( bytes, stride, count - done, values + done );
+        }
+        break;
+
+    case 8:
+        {
+            uint64_t *values = static_cast< uint64_t * >( output );
+            size_t done = 0;
+#if defined( __AVX2__ )
+
+            if ( FitsGather( stride, 4 ) )
+            {
+                done = Gather64( bytes, stride, count, values );
+            }
+
+#endif
+            GatherValues( bytes, stride, count - done, values + done );
+        }
+        break;
+
+    default:
+        {
+            uint8_t *values = static_cast< uint8_t * >( output );
+
+            for ( size_t i = 0; i < count; ++i, bytes += stride, values += size )
+            {
+                memcpy( values, bytes, size );
+            }
+        }
+        break;
+    }
+}
+
+void ReflectionHelper::ScatterStrided( const void *input, size_t count, size_t size, void *destination, size_t stride )
+{
+    uint8_t *bytes = static_cast< uint8_t * >( destination );
+
+    if ( stride == size )
+    {
+        memcpy( bytes, input, count * size );
+        return;
+    }
+
+    switch ( size )
+    {
+    case 1:
+        ScatterValues( static_cast< const uint8_t * >( input ), count, bytes, stride );
+        break;
+
+    case 2:
+        ScatterValues( static_cast< const uint16_t * >( input ), count, bytes, stride );
+        break;
+
+    case 4:
+        {
+            const uint32_t *values = static_cast< const uint32_t * >( input );
+            size_t done = 0;
+#if defined( __AVX512F__ )
+
+            if ( stride * 16 <= INT32_MAX )
+            {
+                done = Scatter32( values, count, bytes, stride );
+            }
+
+#endif
+            ScatterValues( values + done, count - done, bytes, stride );
+        }
+        break;
+
+    case 8:
+        ScatterValues( static_cast< const uint64_t * >( input ), count, bytes, stride );
+        break;
+
+    default:
+        {
+            const uint8_t *values = static_cast< const uint8_t * >( input );
+
+            for ( size_t i = 0; i < count; ++i, bytes += stride, values += size )
+            {
+                memcpy( bytes, values, size );
+            }
+        }
+        break;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,331 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/graph.h"
+
+#include <algorithm>
+
+namespace
+{
+    uint8_t *Align( uint8_t *address, size_t alignment )
+    {
+        return reinterpret_cast< uint8_t * >( ( reinterpret_cast< uintptr_t >( address ) + alignment - 1 ) &
+                                              ~( alignment - 1 ) );
+    }
+
+    struct GraphObject
+    {
+        const ITypeDescription *type;
+        void *object;
+    };
+
+    class GraphWriter
+        : public PointerWriter
+    {
+    public:
+
+        GraphWriter( const ITypeDescription *type, const void *root )
+            : mFailed( false )
+        {
+            mIds.Insert( root, 1 );
+            mObjects.push_back( { type, const_cast< void * >( root ) } );
+        }
+
+        virtual void Write( const ValueType &type, const void *pointer, BinaryWriter &writer ) override
+        {
+            const void *object;
+            memcpy( &object, pointer, sizeof( object ) );
+
+            uint32_t id = 0;
+
+            if ( object && type.reflectedType )
+            {
+                const ITypeDescription *pointee = type.reflectedType();
+                id = mIds.Insert( object, static_cast< uint32_t >( mObjects.size() + 1 ) );
+
+                if ( id > mObjects.size() )
+                {
+                    mObjects.push_back( { pointee, const_cast< void * >( object ) } );
+                }
+                else if ( mObjects[id - 1].type != pointee )
+                {
+                    mFailed = true;
+                }
+            }
+
+            writer.WriteVarInt( id );
+        }
+
+        bool WriteObjects( BinaryWriter &writer )
+        {
+            // the list grows while writing, until every reachable object is written
+            for ( size_t i = 0; i < mObjects.size() && !mFailed; ++i )
+            {
+                Reflect::Serialize( mObjects[i].type, mObjects[i].object, writer, this );
+            }
+
+            return !mFailed;
+        }
+
+    private:
+
+        ObjectTable mIds;
+        std::vector< GraphObject > mObjects;
+        bool mFailed;
+    };
+
+    class GraphReader
+        : public PointerReader
+    {
+    public:
+
+        GraphReader( const ITypeDescription *type, void *root, ObjectArena &arena )
+            : mArena( arena )
+        {
+            mObjects.push_back( { type, root } );
+        }
+
+        virtual bool Read( const ValueType &type, void *pointer, BinaryReader &reader ) override
+        {
+            uint64_t id;
+
+            if ( !reader.ReadVarInt( id ) )
+            {
+                return false;
+            }
+
+            if ( !type.reflectedType )
+            {
+                return id == 0;
+            }
+
+            const ITypeDescription *pointee = type.reflectedType();
+            void *object = nullptr;
+
+            if ( id == mObjects.size() + 1 )
+            {
+                object = mArena.Create( pointee );
+
+                if ( !object )
+                {
+                    return false;
+                }
+
+                mObjects.push_back( { pointee, object } );
+            }
+            else if ( id != 0 )
+            {
+                if ( id > mObjects.size() || mObjects[id - 1].type != pointee )
+                {
+                    return false;
+                }
+
+                object = mObjects[id - 1].object;
+            }
+
+            memcpy( pointer, &object, sizeof( object ) );
+            return true;
+        }
+
+        bool ReadObjects( BinaryReader &reader )
+        {
+            for ( size_t i = 0; i < mObjects.size(); ++i )
+            {
+                if ( !Reflect::Deserialize( mObjects[i].type, mObjects[i].object, reader, this ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    private:
+
+        ObjectArena &mArena;
+        std::vector< GraphObject > mObjects;
+    };
+}
+
+ObjectTable::ObjectTable()
+    : mSlots( 16, Slot{ nullptr, 0 } ),
+      mSize( 0 ),
+      mShift( 64 - 4 )
+{
+}
+
+uint32_t ObjectTable::Insert( const void *object, uint32_t id )
+{
+    assert( object && "Null cannot be added to the table." );
+
+    // keep the table at most half full, so probe sequences stay short
+    if ( ( mSize + 1 ) * 2 > mSlots.size() )
+    {
+        Grow();
+    }
+
+    Slot &slot = mSlots[GetSlot( object )];
+
+    if ( !slot.object )
+    {
+        slot = { object, id };
+        ++mSize;
+    }
+
+    return slot.id;
+}
+
+const uint32_t *ObjectTable::Find( const void *object ) const
+{
+    const Slot &slot = mSlots[GetSlot( object )];
+
+    return slot.object ? &slot.id : nullptr;
+}
+
+void ObjectTable::Clear()
+{
+    std::fill( mSlots.begin(), mSlots.end(), Slot{ nullptr, 0 } );
+    mSize = 0;
+}
+
+size_t ObjectTable::GetSlot( const void *object ) const
+{
+    const size_t mask = mSlots.size() - 1;
+
+    // fibonacci hashing spreads the aligned addresses over the high bits
+    size_t index = static_cast< size_t >( ( reinterpret_cast< uintptr_t >( object ) * 0x9e3779b97f4a7c15ull ) >> mShift );
+
+    while ( mSlots[index].object && mSlots[index].object != object )
+    {
+        index = ( index + 1 ) & mask;
+    }
+
+    return index;
+}
+
+void ObjectTable::Grow()
+{
+    std::vector< Slot > slots( mSlots.size() * 2, Slot{ nullptr, 0 } );
+    slots.swap( mSlots );
+    --mShift;
+
+    for ( const Slot &slot : slots )
+    {
+        if ( slot.object )
+        {
+            mSlots[GetSlot( slot.object )] = slot;
+        }
+    }
+}
+
+ObjectArena::ObjectArena( size_t blockSize )
+    : mCursor( nullptr ),
+      mEnd( nullptr ),
+      mBlockSize( blockSize )
+{
+}
+
+ObjectArena::~ObjectArena()
+{
+    Clear();
+}
+
+void *ObjectArena::Create( const ITypeDescription *type )
+{
+    const ValueType &value = type->GetValueType();
+
+    if ( !value.construct )
+    {
+        return nullptr;
+    }
+
+    void *object = Allocate( value.size, value.alignment );
+    value.construct( object, 1 );
+
+    if ( !value.isTriviallyCopyable )
+    {
+        mDestructors.push_back( { value.destroy, object } );
+    }
+
+    return object;
+}
+
+void ObjectArena::Clear()
+{
+    for ( auto it = mDestructors.rbegin(); it != mDestructors.rend(); ++it )
+    {
+        it->destroy( it->object, 1 );
+    }
+
+    mDestructors.clear();
+
+    if ( mBlocks.empty() )
+    {
+        return;
+    }
+
+    mBlocks.resize( 1 );
+    mCursor = mBlocks.front().get();
+    mEnd = mCursor + mBlockSize;
+}
+
+void *ObjectArena::Allocate( size_t size, size_t alignment )
+{
+    uintptr_t address = reinterpret_cast< uintptr_t >( Align( mCursor, alignment ) );
+
+    if ( !mCursor || address + size > reinterpret_cast< uintptr_t >( mEnd ) )
+    {
+        if ( size + alignment > mBlockSize )
+        {
+            // objects larger than a block get a block of their own, so the current block can still be filled
+            mBlocks.emplace_back( new uint8_t[size + alignment] );
+
+            return Align( mBlocks.back().get(), alignment );
+        }
+
+        mBlocks.emplace_back( new uint8_t[mBlockSize] );
+        mCursor = mBlocks.back().get();
+        mEnd = mCursor + mBlockSize;
+        address = reinterpret_cast< uintptr_t >( Align( mCursor, alignment ) );
+    }
+
+    mCursor = reinterpret_cast< uint8_t * >( address + size );
+    return mCursor - size;
+}
+
+bool Reflect::WriteGraph( const ITypeDescription *type, const void *root, BinaryWriter &writer )
+{
+    GraphWriter graph( type, root );
+
+    return graph.WriteObjects( writer );
+}
+
+bool Reflect::ReadGraph( const ITypeDescription *type, void *root, BinaryReader &reader, ObjectArena &arena )
+{
+    GraphReader graph( type, root, arena );
+
+    return graph.ReadObjects( reader );
+}
\ No newline at end of file
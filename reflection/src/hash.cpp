@@ -0,0 +1,184 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/hash.h"
+
+#if defined( __AVX2__ )
+#   include <immintrin.h>
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+#   include <emmintrin.h>
+#endif
+
+namespace
+{
+    enum
+    {
+        BlockSize = 32,
+
+        // the lanes are scrambled after this many blocks, so no lane accumulates for too long
+        ScrambleInterval = 16
+    };
+
+    const uint64_t gLaneKeys[4] =
+    {
+        0xbe4ba423396cfeb8ULL, 0x1cad21f72c81017cULL, 0xdb979083e96dd4deULL, 0x1f67b3b7a4a44072ULL
+    };
+
+    const uint64_t gScrambleKeys[4] =
+    {
+        0x78e5c0cc4ee679cbULL, 0x2172ffcc7dd05a82ULL, 0x8e2443f7744608b8ULL, 0x4c263a81e69035e0ULL
+    };
+
+    const uint32_t gScrambleMultiplier = 0x9e3779b1U;
+
+    // Every lane adds the product of the low and high halves of its keyed word, and the word of its neighbour
+    void AccumulateScalar( uint64_t *lanes, const uint8_t *blocks, size_t count )
+    {
+        for ( size_t block = 0; block < count; ++block, blocks += BlockSize )
+        {
+            uint64_t words[4];
+            memcpy( words, blocks, sizeof( words ) );
+
+            for ( size_t lane = 0; lane < 4; ++lane )
+            {
+                const uint64_t keyed = words[lane] ^ gLaneKeys[lane];
+                lanes[lane] += ( keyed & 0xffffffffULL ) * ( keyed >> 32 ) + words[lane ^ 1];
+            }
+        }
+    }
+
+    void ScrambleScalar( uint64_t *lanes )
+    {
+        for ( size_t lane = 0; lane < 4; ++lane )
+        {
+            uint64_t value = lanes[lane];
+            value ^= value >> 47;
+            value ^= gScrambleKeys[lane];
+            lanes[lane] = value * gScrambleMultiplier;
+        }
+    }
+
+#if defined( __AVX2__ )
+
+    void Accumulate( uint64_t *lanes, const uint8_t *blocks, size_t count )
+    {
+        __m256i accumulator = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( lanes ) );
+        const __m256i keys = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( gLaneKeys ) );
+
+        for ( size_t block = 0; block < count; ++block, blocks += BlockSize )
+        {
+            const __m256i words = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( blocks ) );
+            const __m256i keyed = _mm256_xor_si256( words, keys );
+            const __m256i product = _mm256_mul_epu32( keyed, _mm256_srli_epi64( keyed, 32 ) );
+            const __m256i swapped = _mm256_shuffle_epi32( words, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+
+            accumulator = _mm256_add_epi64( accumulator, _mm256_add_epi64( product, swapped ) );
+        }
+
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( lanes ), accumulator );
+    }
+
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+
+    void Accumulate( uint64_t *lanes, const uint8_t *blocks, size_t count )
+    {
+        __m128i low = _mm_loadu_si128( reinterpret_cast< const __m128i * >( lanes ) );
+        __m128i high = _mm_loadu_si128( reinterpret_cast< const __m128i * >( lanes + 2 ) );
+        const __m128i lowKeys = _mm_loadu_si128( reinterpret_cast< const __m128i * >( gLaneKeys ) );
+        const __m128i highKeys = _mm_loadu_si128( reinterpret_cast< const __m128i * >( gLaneKeys + 2 ) );
+
+        for ( size_t block = 0; block < count; ++block, blocks += BlockSize )
+        {
+            const __m128i lowWords = _mm_loadu_si128( reinterpret_cast< const __m128i * >( blocks ) );
+            const __m128i highWords = _mm_loadu_si128( reinterpret_cast< const __m128i * >( blocks + 16 ) );
+            const __m128i lowKeyed = _mm_xor_si128( lowWords, lowKeys );
+            const __m128i highKeyed = _mm_xor_si128( highWords, highKeys );
+
+            low = _mm_add_epi64( low, _mm_add_epi64( _mm_mul_epu32( lowKeyed, _mm_srli_epi64( lowKeyed, 32 ) ),
+                                                     _mm_shuffle_epi32( lowWords, _MM_SHUFFLE( 1, 0, 3, 2 ) ) ) );
+            high = _mm_add_epi64( high, _mm_add_epi64( _mm_mul_epu32( highKeyed, _mm_srli_epi64( highKeyed, 32 ) ),
+                                                       _mm_shuffle_epi32( highWords, _MM_SHUFFLE( 1, 0, 3, 2 ) ) ) );
+        }
+
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( lanes ), low );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( lanes + 2 ), high );
+    }
+
+#else
+
+    void Accumulate( uint64_t *lanes, const uint8_t *blocks, size_t count )
+    {
+        AccumulateScalar( lanes, blocks, count );
+    }
+
+#endif
+
+    template< typename tAccumulate >
+    uint64_t HashLanes( const void *data, size_t size, uint64_t seed, tAccumulate accumulate )
+    {
+        if ( size < 2 * BlockSize )
+        {
+            return ReflectionHelper::HashBytes( data, size, seed );
+        }
+
+        const uint8_t *bytes = static_cast< const uint8_t * >( data );
+        uint64_t lanes[4] =
+        {
+            seed ^ gScrambleKeys[0], seed + gScrambleKeys[1], seed ^ gScrambleKeys[2], seed - gScrambleKeys[3]
+        };
+
+        size_t blocks = size / BlockSize;
+
+        for ( ; blocks > ScrambleInterval; blocks -= ScrambleInterval, bytes += ScrambleInterval * BlockSize )
+        {
+            accumulate( lanes, bytes, ScrambleInterval );
+            ScrambleScalar( lanes );
+        }
+
+        accumulate( lanes, bytes, blocks );
+        bytes += blocks * BlockSize;
+
+        // the last partial block is hashed on its own and folded in with the lanes and the size
+        uint64_t hash = ReflectionHelper::HashBytes( bytes, size % BlockSize, seed ^ size );
+
+        for ( size_t lane = 0; lane < 4; ++lane )
+        {
+            hash = ReflectionHelper::MixHash( hash ^ lanes[lane] ) + lane;
+        }
+
+        return hash;
+    }
+}
+
+uint64_t ReflectionHelper::HashBlocks( const void *data, size_t size, uint64_t seed )
+{
+    return HashLanes( data, size, seed, Accumulate );
+}
+
+uint64_t ReflectionHelper::HashBlocksScalar( const void *data, size_t size, uint64_t seed )
+{
+    return HashLanes( data, size, seed, AccumulateScalar );
+}
\ No newline at end of file
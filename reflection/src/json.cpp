@@ -0,0 +1,1059 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/json.h"
+
+#include <charconv>
+#include <limits>
+#include <cmath>
+#include <string.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 )
+#   include <emmintrin.h>
+#   define REFLECTION_JSON_SSE2
+#endif
+
+namespace
+{
+    void AppendEscaped( std::string &buffer, std::string_view text )
+    {
+        static const char hex[] = "0123456789abcdef";
+
+        const char *cursor = text.data();
+        const char *end = cursor + text.size();
+
+        for ( ;; )
+        {
+            const char *special = ReflectionHelper::FindStringSpecial( cursor, end );
+            buffer.append( cursor, special );
+
+            if ( special == end )
+            {
+                return;
+            }
+
+            const unsigned char c = static_cast< unsigned char >( *special );
+
+            switch ( c )
+            {
+            case '"':
+                buffer.append( "\\\"", 2 );
+                break;
+
+            case '\\':
+                buffer.append( "\\\\", 2 );
+                break;
+
+            case '\n':
+                buffer.append( "\\n", 2 );
+                break;
+
+            case '\r':
+                buffer.append( "\\r", 2 );
+                break;
+
+            case '\t':
+                buffer.append( "\\t", 2 );
+                break;
+
+            default:
+                {
+                    const char escape[] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0x0f] };
+                    buffer.append( escape, sizeof( escape ) );
+                }
+                break;
+            }
+
+            cursor = special + 1;
+        }
+    }
+
+    template< typename tValue >
+    void AppendNumber( std::string &buffer, tValue value )
+    {
+        char text[32];
+        const std::to_chars_result result = std::to_chars( text, text + sizeof( text ), value );
+        buffer.append( text, result.ptr );
+    }
+
+    bool IsHex( char c, uint32_t &digit )
+    {
+        if ( c >= '0' && c <= '9' )
+        {
+            digit = static_cast< uint32_t >( c - '0' );
+        }
+        else if ( ( c | 0x20 ) >= 'a' && ( c | 0x20 ) <= 'f' )
+        {
+            digit = static_cast< uint32_t >( ( c | 0x20 ) - 'a' + 10 );
+        }
+        else
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ReadHex( const char *&cursor, const char *end, uint32_t &code )
+    {
+        if ( end - cursor < 4 )
+        {
+            return false;
+        }
+
+        code = 0;
+
+        for ( const char *last = cursor + 4; cursor != last; ++cursor )
+        {
+            uint32_t digit;
+
+            if ( !IsHex( *cursor, digit ) )
+            {
+                return false;
+            }
+
+            code = code << 4 | digit;
+        }
+
+        return true;
+    }
+
+    void AppendUtf8( std::string &buffer, uint32_t code )
+    {
+        if ( code < 0x80 )
+        {
+            buffer.push_back( static_cast< char >( code ) );
+        }
+        else if ( code < 0x800 )
+        {
+            buffer.push_back( static_cast< char >( 0xc0 | code >> 6 ) );
+            buffer.push_back( static_cast< char >( 0x80 | ( code & 0x3f ) ) );
+        }
+        else if ( code < 0x10000 )
+        {
+            buffer.push_back( static_cast< char >( 0xe0 | code >> 12 ) );
+            buffer.push_back( static_cast< char >( 0x80 | ( code >> 6 & 0x3f ) ) );
+            buffer.push_back( static_cast< char >( 0x80 | ( code & 0x3f ) ) );
+        }
+        else
+        {
+            buffer.push_back( static_cast< char >( 0xf0 | code >> 18 ) );
+            buffer.push_back( static_cast< char >( 0x80 | ( code >> 12 & 0x3f ) ) );
+            buffer.push_back( static_cast< char >( 0x80 | ( code >> 6 & 0x3f ) ) );
+            buffer.push_back( static_cast< char >( 0x80 | ( code & 0x3f ) ) );
+        }
+    }
+
+    template< typename tValue >
+    bool ParseNumber( std::string_view text, tValue &value )
+    {
+        const char *end = text.data() + text.size();
+        const std::from_chars_result result = std::from_chars( text.data(), end, value );
+
+        return result.ec == std::errc() && result.ptr == end;
+    }
+}
+
+void JsonWriter::Key( std::string_view name )
+{
+    Separate();
+    mBuffer.push_back( '"' );
+    AppendEscaped( mBuffer, name );
+    mBuffer.append( "\":", 2 );
+    mSeparate = false;
+}
+
+void JsonWriter::String( std::string_view value )
+{
+    Separate();
+    mBuffer.push_back( '"' );
+    AppendEscaped( mBuffer, value );
+    mBuffer.push_back( '"' );
+    mSeparate = true;
+}
+
+void JsonWriter::Int( int64_t value )
+{
+    Separate();
+    AppendNumber( mBuffer, value );
+    mSeparate = true;
+}
+
+void JsonWriter::UInt( uint64_t value )
+{
+    Separate();
+    AppendNumber( mBuffer, value );
+    mSeparate = true;
+}
+
+void JsonWriter::Float( float value )
+{
+    if ( !std::isfinite( value ) )
+    {
+        Null();
+        return;
+    }
+
+    Separate();
+    AppendNumber( mBuffer, value );
+    mSeparate = true;
+}
+
+void JsonWriter::Double( double value )
+{
+    if ( !std::isfinite( value ) )
+    {
+        Null();
+        return;
+    }
+
+    Separate();
+    AppendNumber( mBuffer, value );
+    mSeparate = true;
+}
+
+JsonReader::JsonReader( std::string_view text )
+    : mBegin( text.data() ),
+      mCursor( text.data() ),
+      mEnd( text.data() + text.size() ),
+      mState( State::Value )
+{
+}
+
+JsonToken JsonReader::Next()
+{
+    for ( ;; )
+    {
+        SkipWhitespace();
+
+        switch ( mState )
+        {
+        case State::Value:
+            return ReadValue();
+
+        case State::ValueOrEnd:
+            return mCursor != mEnd && *mCursor == ']' ? Close( ']' ) : ReadValue();
+
+        case State::KeyOrEnd:
+            if ( mCursor != mEnd && *mCursor == '}' )
+            {
+                return Close( '}' );
+            }
+
+        // fall through
+        case State::Key:
+            if ( mCursor == mEnd || *mCursor != '"' )
+            {
+                return Fail();
+            }
+
+            ++mCursor;
+
+            if ( !ReadString() )
+            {
+                return Fail();
+            }
+
+            SkipWhitespace();
+
+            if ( mCursor == mEnd || *mCursor != ':' )
+            {
+                return Fail();
+            }
+
+            ++mCursor;
+            mState = State::Value;
+            return JsonToken::Key;
+
+        case State::AfterValue:
+            if ( mStack.empty() )
+            {
+                return mCursor == mEnd ? JsonToken::End : Fail();
+            }
+
+            if ( mCursor == mEnd )
+            {
+                return Fail();
+            }
+
+            if ( *mCursor == ',' )
+            {
+                ++mCursor;
+                mState = mStack.back() == '{' ? State::Key : State::Value;
+                continue;
+            }
+
+            return Close( *mCursor );
+
+        case State::Error:
+            return JsonToken::Error;
+        }
+    }
+}
+
+bool JsonReader::SkipValue()
+{
+    const JsonToken token = Next();
+
+    if ( token != JsonToken::BeginObject && token != JsonToken::BeginArray )
+    {
+        return token == JsonToken::String || token == JsonToken::Number || token == JsonToken::True ||
+               token == JsonToken::False || token == JsonToken::Null;
+    }
+
+    // only the brackets of the skipped value are matched, its contents are not validated
+    size_t depth = 1;
+
+    while ( depth > 0 )
+    {
+        mCursor = ReflectionHelper::FindStructural( mCursor, mEnd );
+
+        if ( mCursor == mEnd )
+        {
+            Fail();
+            return false;
+        }
+
+        const char c = *mCursor++;
+
+        if ( c == '"' )
+        {
+            for ( ;; )
+            {
+                mCursor = ReflectionHelper::FindStringSpecial( mCursor, mEnd );
+
+                if ( mCursor == mEnd )
+                {
+                    Fail();
+                    return false;
+                }
+
+                const char special = *mCursor;
+                mCursor += special == '\\' && mEnd - mCursor > 1 ? 2 : 1;
+
+                if ( special == '"' )
+                {
+                    break;
+                }
+            }
+        }
+        else if ( c == '{' || c == '[' )
+        {
+            ++depth;
+        }
+        else
+        {
+            --depth;
+        }
+    }
+
+    mStack.pop_back();
+    mState = State::AfterValue;
+    return true;
+}
+
+bool JsonReader::GetInt( int64_t &value ) const
+{
+    return ParseNumber( mNumber, value );
+}
+
+bool JsonReader::GetUInt( uint64_t &value ) const
+{
+    return ParseNumber( mNumber, value );
+}
+
+bool JsonReader::GetDouble( double &value ) const
+{
+    return ParseNumber( mNumber, value );
+}
+
+JsonToken JsonReader::ReadValue()
+{
+    if ( mCursor == mEnd )
+    {
+        return Fail();
+    }
+
+    const char c = *mCursor;
+
+    switch ( c )
+    {
+    case '{':
+        ++mCursor;
+        mStack.push_back( '{' );
+        mState = State::KeyOrEnd;
+        return JsonToken::BeginObject;
+
+    case '[':
+        ++mCursor;
+        mStack.push_back( '[' );
+        mState = State::ValueOrEnd;
+        return JsonToken::BeginArray;
+
+    case '"':
+        ++mCursor;
+
+        if ( !ReadString() )
+        {
+            return Fail();
+        }
+
+        mState = State::AfterValue;
+        return JsonToken::String;
+
+    case 't':
+        mState = State::AfterValue;
+        return ReadLiteral( "true", 4 ) ? JsonToken::True : Fail();
+
+    case 'f':
+        mState = State::AfterValue;
+        return ReadLiteral( "false", 5 ) ? JsonToken::False : Fail();
+
+    case 'n':
+        mState = State::AfterValue;
+        return ReadLiteral( "null", 4 ) ? JsonToken::Null : Fail();
+
+    default:
+        break;
+    }
+
+    if ( c != '-' && ( c < '0' || c > '9' ) )
+    {
+        return Fail();
+    }
+
+    // the number is validated when it is converted
+    const char *start = mCursor;
+
+    for ( ++mCursor; mCursor != mEnd; ++mCursor )
+    {
+        const char digit = *mCursor;
+
+        if ( ( digit < '0' || digit > '9' ) && digit != '.' && digit != 'e' && digit != 'E' && digit != '+' &&
+             digit != '-' )
+        {
+            break;
+        }
+    }
+
+    mNumber = std::string_view( start, static_cast< size_t >( mCursor - start ) );
+    mState = State::AfterValue;
+    return JsonToken::Number;
+}
+
+JsonToken JsonReader::Close( char bracket )
+{
+    if ( mStack.empty() || bracket != ( mStack.back() == '{' ? '}' : ']' ) )
+    {
+        return Fail();
+    }
+
+    ++mCursor;
+    mStack.pop_back();
+    mState = State::AfterValue;
+    return bracket == '}' ? JsonToken::EndObject : JsonToken::EndArray;
+}
+
+JsonToken JsonReader::Fail()
+{
+    mState = State::Error;
+    return JsonToken::Error;
+}
+
+bool JsonReader::ReadString()
+{
+    const char *start = mCursor;
+    const char *special = ReflectionHelper::FindStringSpecial( mCursor, mEnd );
+
+    if ( special != mEnd && *special == '"' )
+    {
+        mString = std::string_view( start, static_cast< size_t >( special - start ) );
+        mCursor = special + 1;
+        return true;
+    }
+
+    // strings with escapes are decoded into the scratch buffer
+    mScratch.assign( start, special );
+    mCursor = special;
+
+    for ( ;; )
+    {
+        if ( mCursor == mEnd )
+        {
+            return false;
+        }
+
+        const char c = *mCursor++;
+
+        if ( c == '"' )
+        {
+            mString = mScratch;
+            return true;
+        }
+
+        if ( c != '\\' || !ReadEscape() )
+        {
+            return false;
+        }
+
+        special = ReflectionHelper::FindStringSpecial( mCursor, mEnd );
+        mScratch.append( mCursor, special );
+        mCursor = special;
+    }
+}
+
+bool JsonReader::ReadEscape()
+{
+    if ( mCursor == mEnd )
+    {
+        return false;
+    }
+
+    switch ( *mCursor++ )
+    {
+    case '"':
+        mScratch.push_back( '"' );
+        return true;
+
+    case '\\':
+        mScratch.push_back( '\\' );
+        return true;
+
+    case '/':
+        mScratch.push_back( '/' );
+        return true;
+
+    case 'b':
+        mScratch.push_back( '\b' );
+        return true;
+
+    case 'f':
+        mScratch.push_back( '\f' );
+        return true;
+
+    case 'n':
+        mScratch.push_back( '\n' );
+        return true;
+
+    case 'r':
+        mScratch.push_back( '\r' );
+        return true;
+
+    case 't':
+        mScratch.push_back( '\t' );
+        return true;
+
+    case 'u':
+        break;
+
+    default:
+        return false;
+    }
+
+    uint32_t code;
+
+    if ( !ReadHex( mCursor, mEnd, code ) || ( code >= 0xdc00 && code < 0xe000 ) )
+    {
+        return false;
+    }
+
+    // characters outside the basic plane are escaped as a pair of surrogates
+    if ( code >= 0xd800 && code < 0xdc00 )
+    {
+        uint32_t low;
+
+        if ( mEnd - mCursor < 2 || mCursor[0] != '\\' || mCursor[1] != 'u' )
+        {
+            return false;
+        }
+
+        mCursor += 2;
+
+        if ( !ReadHex( mCursor, mEnd, low ) || low < 0xdc00 || low >= 0xe000 )
+        {
+            return false;
+        }
+
+        code = 0x10000 + ( ( code - 0xd800 ) << 10 ) + ( low - 0xdc00 );
+    }
+
+    AppendUtf8( mScratch, code );
+    return true;
+}
+
+bool JsonReader::ReadLiteral( const char *literal, size_t size )
+{
+    if ( static_cast< size_t >( mEnd - mCursor ) < size || memcmp( mCursor, literal, size ) != 0 )
+    {
+        return false;
+    }
+
+    mCursor += size;
+    return true;
+}
+
+void JsonReader::SkipWhitespace()
+{
+    while ( mCursor != mEnd && ( *mCursor == ' ' || *mCursor == '\n' || *mCursor == '\r' || *mCursor == '\t' ) )
+    {
+        ++mCursor;
+    }
+}
+
+const char *ReflectionHelper::FindStringSpecial( const char *cursor, const char *end )
+{
+#if defined( REFLECTION_JSON_SSE2 )
+    const __m128i quote = _mm_set1_epi8( '"' );
+    const __m128i backslash = _mm_set1_epi8( '\\' );
+    const __m128i control = _mm_set1_epi8( 0x1f );
+
+    for ( ; end - cursor >= 16; cursor += 16 )
+    {
+        const __m128i bytes = _mm_loadu_si128( reinterpret_cast< const __m128i * >( cursor ) );
+
+        // a byte is a control character when the unsigned minimum with 0x1f leaves it unchanged
+        const __m128i special = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( bytes, quote ),
+                                                            _mm_cmpeq_epi8( bytes, backslash ) ),
+                                              _mm_cmpeq_epi8( _mm_min_epu8( bytes, control ), bytes ) );
+
+        const uint32_t mask = static_cast< uint32_t >( _mm_movemask_epi8( special ) );
+
+        if ( mask != 0 )
+        {
+            return cursor + CountTrailingZeros( mask );
+        }
+    }
+#endif
+
+    for ( ; cursor != end; ++cursor )
+    {
+        const unsigned char c = static_cast< unsigned char >( *cursor );
+
+        if ( c == '"' || c == '\\' || c < 0x20 )
+        {
+            return cursor;
+        }
+    }
+
+    return end;
+}
+
+const char *ReflectionHelper::FindStructural( const char *cursor, const char *end )
+{
+#if defined( REFLECTION_JSON_SSE2 )
+    const __m128i quote = _mm_set1_epi8( '"' );
+    const __m128i lower = _mm_set1_epi8( 0x20 );
+    const __m128i open = _mm_set1_epi8( '{' );
+    const __m128i close = _mm_set1_epi8( '}' );
+
+    for ( ; end - cursor >= 16; cursor += 16 )
+    {
+        const __m128i bytes = _mm_loadu_si128( reinterpret_cast< const __m128i * >( cursor ) );
+
+        // setting 0x20 maps the brackets onto the braces, and no other byte onto them
+        const __m128i folded = _mm_or_si128( bytes, lower );
+        const __m128i structural = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( folded, open ),
+                                                               _mm_cmpeq_epi8( folded, close ) ),
+                                                 _mm_cmpeq_epi8( bytes, quote ) );
+
+        const uint32_t mask = static_cast< uint32_t >( _mm_movemask_epi8( structural ) );
+
+        if ( mask != 0 )
+        {
+            return cursor + CountTrailingZeros( mask );
+        }
+    }
+#endif
+
+    for ( ; cursor != end; ++cursor )
+    {
+        const char c = *cursor;
+
+        if ( c == '{' || c == '}' || c == '[' || c == ']' || c == '"' )
+        {
+            return cursor;
+        }
+    }
+
+    return end;
+}
+
+namespace
+{
+    void WriteObject( const ITypeDescription *type, const uint8_t *object, JsonWriter &writer );
+
+    bool ReadMembers( const ITypeDescription *type, uint8_t *object, JsonReader &reader );
+
+    bool IsSupported( const ValueType &type )
+    {
+        switch ( type.kind )
+        {
+        case ValueKind::Trivial:
+            return type.scalar != ScalarKind::None || type.reflectedType;
+
+        case ValueKind::Sequence:
+            return IsSupported( *type.element );
+
+        case ValueKind::Class:
+            return true;
+
+        case ValueKind::Pointer:
+        case ValueKind::Unsupported:
+            break;
+        }
+
+        return false;
+    }
+
+    template< typename tValue >
+    tValue Load( const void *value )
+    {
+        tValue result;
+        memcpy( &result, value, sizeof( tValue ) );
+        return result;
+    }
+
+    template< typename tValue >
+    void Store( void *value, tValue result )
+    {
+        memcpy( value, &result, sizeof( tValue ) );
+    }
+
+    void WriteScalar( const ValueType &type, const void *value, JsonWriter &writer )
+    {
+        switch ( type.scalar )
+        {
+        case ScalarKind::Bool:
+            writer.Bool( Load< bool >( value ) );
+            break;
+
+        case ScalarKind::Char:
+            writer.String( std::string_view( static_cast< const char * >( value ), 1 ) );
+            break;
+
+        case ScalarKind::Signed:
+            writer.Int( type.size == 1 ? Load< int8_t >( value ) : type.size == 2 ? Load< int16_t >( value ) :
+                        type.size == 4 ? Load< int32_t >( value ) : Load< int64_t >( value ) );
+            break;
+
+        case ScalarKind::Unsigned:
+            writer.UInt( type.size == 1 ? Load< uint8_t >( value ) : type.size == 2 ? Load< uint16_t >( value ) :
+                         type.size == 4 ? Load< uint32_t >( value ) : Load< uint64_t >( value ) );
+            break;
+
+        case ScalarKind::Float:
+            if ( type.size == sizeof( float ) )
+            {
+                writer.Float( Load< float >( value ) );
+            }
+            else
+            {
+                writer.Double( type.size == sizeof( double ) ? Load< double >( value ) :
+                               static_cast< double >( Load< long double >( value ) ) );
+            }
+
+            break;
+
+        case ScalarKind::None:
+            break;
+        }
+    }
+
+    void WriteValue( const ValueType &type, const void *value, JsonWriter &writer )
+    {
+        if ( type.scalar != ScalarKind::None )
+        {
+            WriteScalar( type, value, writer );
+            return;
+        }
+
+        if ( type.kind != ValueKind::Sequence )
+        {
+            WriteObject( type.reflectedType(), static_cast< const uint8_t * >( value ), writer );
+            return;
+        }
+
+        const ValueType &element = *type.element;
+        const size_t count = type.count( value );
+        const uint8_t *elements = static_cast< const uint8_t * >( type.data( value ) );
+
+        if ( element.scalar == ScalarKind::Char )
+        {
+            writer.String( std::string_view( reinterpret_cast< const char * >( elements ), count ) );
+            return;
+        }
+
+        writer.BeginArray();
+
+        for ( size_t i = 0; i < count; ++i )
+        {
+            WriteValue( element, elements + i * element.size, writer );
+        }
+
+        writer.EndArray();
+    }
+
+    void WriteObject( const ITypeDescription *type, const uint8_t *object, JsonWriter &writer )
+    {
+        writer.BeginObject();
+
+        if ( type->GetProperties() )
+        {
+            for ( const AbstractProperty *property : type->GetProperties()->GetNamedView() )
+            {
+                const ValueType &value = property->GetValueType();
+
+                if ( !IsSupported( value ) )
+                {
+                    continue;
+                }
+
+                const void *address = property->HasOffset() ? object + property->GetOffset() :
+                                      property->Get( const_cast< uint8_t * >( object ) );
+
+                writer.Key( property->GetCName() );
+                WriteValue( value, address, writer );
+            }
+        }
+
+        writer.EndObject();
+    }
+
+    template< typename tValue, typename tNumber >
+    bool StoreChecked( void *value, tNumber number )
+    {
+        if ( number < std::numeric_limits< tValue >::min() || number > std::numeric_limits< tValue >::max() )
+        {
+            return false;
+        }
+
+        Store( value, static_cast< tValue >( number ) );
+        return true;
+    }
+
+    bool ReadScalar( const ValueType &type, void *value, JsonReader &reader, JsonToken token )
+    {
+        switch ( type.scalar )
+        {
+        case ScalarKind::Bool:
+            if ( token != JsonToken::True && token != JsonToken::False )
+            {
+                return false;
+            }
+
+            Store( value, token == JsonToken::True );
+            return true;
+
+        case ScalarKind::Char:
+            if ( token != JsonToken::String || reader.GetString().size() != 1 )
+            {
+                return false;
+            }
+
+            Store( value, reader.GetString()[0] );
+            return true;
+
+        case ScalarKind::Signed:
+            {
+                int64_t number;
+
+                if ( token != JsonToken::Number || !reader.GetInt( number ) )
+                {
+                    return false;
+                }
+
+                return type.size == 1 ? StoreChecked< int8_t >( value, number ) :
+                       type.size == 2 ? StoreChecked< int16_t >( value, number ) :
+                       type.size == 4 ? StoreChecked< int32_t >( value, number ) :
+                       StoreChecked< int64_t >( value, number );
+            }
+
+        case ScalarKind::Unsigned:
+            {
+                uint64_t number;
+
+                if ( token != JsonToken::Number || !reader.GetUInt( number ) )
+                {
+                    return false;
+                }
+
+                return type.size == 1 ? StoreChecked< uint8_t >( value, number ) :
+                       type.size == 2 ? StoreChecked< uint16_t >( value, number ) :
+                       type.size == 4 ? StoreChecked< uint32_t >( value, number ) :
+                       StoreChecked< uint64_t >( value, number );
+            }
+
+        case ScalarKind::Float:
+            {
+                double number;
+
+                if ( token != JsonToken::Number || !reader.GetDouble( number ) )
+                {
+                    return false;
+                }
+
+                if ( type.size == sizeof( float ) )
+                {
+                    Store( value, static_cast< float >( number ) );
+                }
+                else if ( type.size == sizeof( double ) )
+                {
+                    Store( value, number );
+                }
+                else
+                {
+                    Store( value, static_cast< long double >( number ) );
+                }
+
+                return true;
+            }
+
+        case ScalarKind::None:
+            break;
+        }
+
+        return false;
+    }
+
+    bool ReadValue( const ValueType &type, void *value, JsonReader &reader, JsonToken token )
+    {
+        // a null leaves the value unchanged
+        if ( token == JsonToken::Null )
+        {
+            return true;
+        }
+
+        if ( type.scalar != ScalarKind::None )
+        {
+            return ReadScalar( type, value, reader, token );
+        }
+
+        if ( type.kind != ValueKind::Sequence )
+        {
+            return token == JsonToken::BeginObject &&
+                   ReadMembers( type.reflectedType(), static_cast< uint8_t * >( value ), reader );
+        }
+
+        const ValueType &element = *type.element;
+
+        if ( element.scalar == ScalarKind::Char )
+        {
+            if ( token != JsonToken::String )
+            {
+                return false;
+            }
+
+            const std::string_view text = reader.GetString();
+            void *elements = type.resize( value, text.size() );
+
+            if ( !text.empty() )
+            {
+                memcpy( elements, text.data(), text.size() );
+            }
+
+            return true;
+        }
+
+        if ( token != JsonToken::BeginArray )
+        {
+            return false;
+        }
+
+        // the existing elements are assigned before the sequence grows
+        size_t capacity = type.count( value );
+        uint8_t *elements = static_cast< uint8_t * >( const_cast< void * >( type.data( value ) ) );
+        size_t count = 0;
+
+        for ( token = reader.Next(); token != JsonToken::EndArray; token = reader.Next(), ++count )
+        {
+            if ( count == capacity )
+            {
+                elements = static_cast< uint8_t * >( type.resize( value, ++capacity ) );
+            }
+
+            if ( !ReadValue( element, elements + count * element.size, reader, token ) )
+            {
+                return false;
+            }
+        }
+
+        if ( count != capacity )
+        {
+            type.resize( value, count );
+        }
+
+        return true;
+    }
+
+    bool ReadMembers( const ITypeDescription *type, uint8_t *object, JsonReader &reader )
+    {
+        const AbstractProperties *properties = type->GetProperties();
+
+        for ( ;; )
+        {
+            const JsonToken token = reader.Next();
+
+            if ( token == JsonToken::EndObject )
+            {
+                return true;
+            }
+
+            if ( token != JsonToken::Key )
+            {
+                return false;
+            }
+
+            AbstractProperty *property = properties ? properties->FindByName( reader.GetString() ) : nullptr;
+
+            if ( !property || !IsSupported( property->GetValueType() ) )
+            {
+                if ( !reader.SkipValue() )
+                {
+                    return false;
+                }
+
+                continue;
+            }
+
+            void *value = property->HasOffset() ? object + property->GetOffset() : property->Get( object );
+
+            if ( !ReadValue( property->GetValueType(), value, reader, reader.Next() ) )
+            {
+                return false;
+            }
+        }
+    }
+}
+
+void Reflect::WriteJson( const ITypeDescription *type, const void *object, JsonWriter &writer )
+{
+    WriteObject( type, static_cast< const uint8_t * >( object ), writer );
+}
+
+bool Reflect::ReadJson( const ITypeDescription *type, void *object, JsonReader &reader )
+{
+    return reader.Next() == JsonToken::BeginObject && ReadMembers( type, static_cast< uint8_t * >( object ), reader );
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/plan.h"
+
+#include "reflection/abstract/ITypeDescription.h"
+#include "reflection/abstract/abstractProperty.h"
+#include "reflection/typeDescription.h"
+
+TypePlan::TypePlan( const ITypeDescription *type )
+    : mCopySize( 0 )
+{
+    Compile( type, 0, 0 );
+    CompileFields( type );
+}
+
+void TypePlan::Append( const PlanOp &op )
+{
+    if ( op.code == PlanOp::Code::Copy )
+    {
+        mCopySize += op.size;
+
+        if ( !mOps.empty() && mOps.back().code == PlanOp::Code::Copy && mOps.back().offset + mOps.back().size == op.offset &&
+             mOps.back().customFlags == op.customFlags )
+        {
+            mOps.back().size += op.size;
+            return;
+        }
+    }
+
+    mOps.push_back( op );
+}
+
+void TypePlan::Compile( const ITypeDescription *type, uint32_t offset, uint32_t customFlags )
+{
+    const AbstractProperties *properties = type->GetProperties();
+
+    if ( !properties )
+    {
+        return;
+    }
+
+    for ( const AbstractProperty *property : properties->GetView() )
+    {
+        const ValueType &value = property->GetValueType();
+        const uint32_t flags = customFlags | property->GetCustomFlags();
+
+        if ( !property->HasOffset() )
+        {
+            Append( { PlanOp::Code::Property, offset, property->GetSize(), &value, property, flags } );
+            continue;
+        }
+
+        const uint32_t at = offset + property->GetOffset();
+
+        switch ( value.kind )
+        {
+        case ValueKind::Trivial:
+            if ( IsInlined( value ) )
+            {
+                Compile( value.reflectedType(), at, flags );
+                break;
+            }
+
+            Append( { PlanOp::Code::Copy, at, property->GetSize(), &value, property, flags } );
+            break;
+
+        case ValueKind::Sequence:
+            Append( { PlanOp::Code::Sequence, at, property->GetSize(), &value, property, flags } );
+            break;
+
+        case ValueKind::Class:
+            // an object at a fixed offset cannot contain itself, so its plan is inlined
+            Compile( value.reflectedType(), at, flags );
+            break;
+
+        case ValueKind::Pointer:
+            Append( { PlanOp::Code::Pointer, at, property->GetSize(), &value, property, flags } );
+            break;
+
+        case ValueKind::Unsupported:
+            break;
+        }
+    }
+}
+
+bool TypePlan::IsInlined( const ValueType &value )
+{
+    if ( !value.reflectedType )
+    {
+        return false;
+    }
+
+    const AbstractProperties *properties = value.reflectedType()->GetProperties();
+
+    if ( !properties || properties->GetView().size() == 0 )
+    {
+        return false;
+    }
+
+    // a class whose properties do not all have a fixed offset is cheaper to copy as a whole
+    for ( const AbstractProperty *property : properties->GetView() )
+    {
+        if ( !property->HasOffset() )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void TypePlan::CompileFields( const ITypeDescription *type )
+{
+    const AbstractProperties *properties = type->GetProperties();
+
+    if ( !properties )
+    {
+        return;
+    }
+
+    size_t runStart = 0;
+
+    for ( const AbstractProperty *property : properties->GetView() )
+    {
+        const ValueType &value = property->GetValueType();
+        const size_t index = mFields.size();
+
+        if ( !property->HasOffset() || value.kind != ValueKind::Trivial )
+        {
+            mFields.push_back( { 0, property->GetSize(), 0, &value, property } );
+            continue;
+        }
+
+        mFields.push_back( { property->GetOffset(), property->GetSize(), 0, &value, property } );
+
+        // a run continues while every field starts where the previous one ends
+        const PlanField *previous = index > 0 ? &mFields[index - 1] : nullptr;
+
+        if ( !previous || previous->runEnd == 0 || previous->offset + previous->size != property->GetOffset() )
+        {
+            runStart = index;
+        }
+
+        for ( size_t i = runStart; i <= index; ++i )
+        {
+            mFields[i].runEnd = static_cast< uint32_t >( index + 1 );
+        }
+    }
+}
+
+const TypePlan &ITypeDescription::BuildPlan() const
+{
+    const TypePlan *plan = new TypePlan( this );
+    const TypePlan *expected = nullptr;
+
+    // another thread may have built the plan in the mean time
+    if ( !mPlan.compare_exchange_strong( expected, plan, std::memory_order_acq_rel ) )
+    {
+        delete plan;
+        return *expected;
+    }
+
+    return *plan;
+}
\ No newline at end of file
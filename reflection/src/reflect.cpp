@@ -27,12 +27,33 @@
 #include "reflection/reflection.h"
 #include "reflection/reflect.h"
 
-const ITypeDescription *Reflect::GetType( const std::string &name )
+const ITypeDescription *Reflect::GetType( std::string_view name )
 {
     return InternalReflection::GetInstance()->ReflectType( name );
 }
 
+const ITypeDescription *Reflect::GetType( uint64_t typeId )
+{
+    return InternalReflection::GetInstance()->ReflectType( typeId );
+}
+
+std::vector< const ITypeDescription * > Reflect::FindTypes( uint32_t flags )
+{
+    return InternalReflection::GetInstance()->FindTypes( flags );
+}
+
 void Reflect::ClearAll()
 {
     InternalReflection::GetInstance()->ClearTypes();
 }
+
+
+void Reflect::Freeze()
+{
+    InternalReflection::GetInstance()->Freeze();
+}
+
+bool Reflect::IsFrozen()
+{
+    return InternalReflection::GetInstance()->IsFrozen();
+}
@@ -26,8 +26,32 @@
 
 #include "reflection/reflection.h"
 
+#include <algorithm>
+
+namespace
+{
+    void SetBit( std::vector< uint64_t > &bits, size_t index )
+    {
+        if ( index / 64 >= bits.size() )
+        {
+            bits.resize( index / 64 + 1, 0 );
+        }
+
+        bits[index / 64] |= 1ull << ( index % 64 );
+    }
+
+    void ClearBit( std::vector< uint64_t > &bits, size_t index )
+    {
+        if ( index / 64 < bits.size() )
+        {
+            bits[index / 64] &= ~( 1ull << ( index % 64 ) );
+        }
+    }
+}
+
 InternalReflection::InternalReflection()
-    : mClassIDCounter( 0 )
+    : mClassIDCounter( 0 ),
+      mFrozen( false )
 {
 
 }
@@ -39,13 +63,135 @@ InternalReflection::~InternalReflection()
 
 void InternalReflection::ClearTypes()
 {
-    for ( auto &types : mTypes )
+    std::lock_guard< std::recursive_mutex > lock( mRegistryLock );
+
+    for ( std::atomic< ITypeDescription * > *type : mPublished )
     {
-        delete types.second;
+        type->store( nullptr, std::memory_order_relaxed );
+    }
+
+    mPublished.clear();
+
+    for ( size_t classId = 0, end = mTypes.GetCapacity(); classId < end; ++classId )
+    {
+        delete mTypes.Find( classId );
     }
 
     mNameCache.clear();
-    mTypes.clear();
+    mNameIndex.Clear();
+    mTypeIDs.clear();
+    mTypes.Clear();
+    mRegistered.clear();
+
+    for ( std::vector< uint64_t > &index : mFlagIndex )
+    {
+        index.clear();
+    }
+
+    mFrozen = false;
+}
+
+void InternalReflection::Freeze()
+{
+    std::lock_guard< std::recursive_mutex > lock( mRegistryLock );
+
+    std::vector< std::pair< std::string_view, ITypeDescription * > > names;
+    names.reserve( mNameCache.size() );
+
+    for ( const auto &name : mNameCache )
+    {
+        names.emplace_back( name.first, mTypes.Find( name.second ) );
+    }
+
+    mNameIndex.Build( names );
+
+    mFrozen = true;
+}
+
+bool InternalReflection::IsFrozen() const
+{
+    return mFrozen;
+}
+
+void InternalReflection::RegisterTypeID( ITypeDescription *type )
+{
+    if ( !mTypeIDs.insert( std::make_pair( type->GetTypeID(), type ) ).second )
+    {
+        throw std::logic_error( "The type ID collides with an already registered type, please declare a unique type ID." );
+    }
+}
+
+void InternalReflection::UnregisterTypeID( ITypeDescription *type )
+{
+    auto typeIt = mTypeIDs.find( type->GetTypeID() );
+
+    if ( typeIt != mTypeIDs.end() && typeIt->second == type )
+    {
+        mTypeIDs.erase( typeIt );
+    }
+}
+
+void InternalReflection::IndexType( const ITypeDescription *type, size_t classId )
+{
+    const uint32_t flags = type->GetFlags();
+
+    SetBit( mRegistered, classId );
+
+    for ( uint32_t flag = 0; flag < ITypeDescription::FlagCount; ++flag )
+    {
+        if ( flags & ( 1u << flag ) )
+        {
+            SetBit( mFlagIndex[flag], classId );
+        }
+    }
+}
+
+void InternalReflection::UnindexType( size_t classId )
+{
+    ClearBit( mRegistered, classId );
+
+    for ( std::vector< uint64_t > &index : mFlagIndex )
+    {
+        ClearBit( index, classId );
+    }
+}
+
+std::vector< const ITypeDescription * > InternalReflection::CollectTypes( uint32_t flags ) const
+{
+    assert( flags < ( 1u << ITypeDescription::FlagCount ) && "Unknown type flags." );
+
+    const std::vector< uint64_t > *indices[ITypeDescription::FlagCount];
+    size_t indexCount = 0;
+    size_t words = mRegistered.size();
+
+    for ( uint32_t flag = 0; flag < ITypeDescription::FlagCount; ++flag )
+    {
+        if ( flags & ( 1u << flag ) )
+        {
+            indices[indexCount++] = &mFlagIndex[flag];
+            words = std::min( words, mFlagIndex[flag].size() );
+        }
+    }
+
+    std::vector< const ITypeDescription * > types;
+
+    // intersect the bitsets 64 class IDs at a time
+    for ( size_t word = 0; word < words; ++word )
+    {
+        uint64_t bits = mRegistered[word];
+
+        for ( size_t i = 0; i < indexCount && bits; ++i )
+        {
+            bits &= ( *indices[i] )[word];
+        }
+
+        for ( ; bits; bits &= bits - 1 )
+        {
+            types.push_back( mTypes.Find( word * 64 + ReflectionHelper::CountTrailingZeros( bits ) ) );
+        }
+    }
+
+    return types;
 }
 
 InternalReflection *InternalReflection::GetInstance( InternalReflection *reflection /*= nullptr */ )
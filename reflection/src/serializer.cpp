@@ -0,0 +1,221 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/serializer.h"
+
+namespace
+{
+    void WriteObject( const ITypeDescription *type, const uint8_t *object, BinaryWriter &writer,
+                      PointerWriter *pointers );
+
+    bool ReadObject( const ITypeDescription *type, uint8_t *object, BinaryReader &reader, PointerReader *pointers );
+
+    void WriteValue( const ValueType &type, const void *value, BinaryWriter &writer, PointerWriter *pointers )
+    {
+        switch ( type.kind )
+        {
+        case ValueKind::Trivial:
+            writer.Write( value, type.size );
+            break;
+
+        case ValueKind::Sequence:
+            {
+                const ValueType &element = *type.element;
+                const size_t count = type.count( value );
+                const uint8_t *elements = static_cast< const uint8_t * >( type.data( value ) );
+
+                writer.WriteCount( count );
+
+                if ( element.kind == ValueKind::Trivial )
+                {
+                    writer.Write( elements, count * element.size );
+                }
+                else if ( element.kind == ValueKind::Class )
+                {
+                    const ITypeDescription *elementType = element.reflectedType();
+
+                    for ( size_t i = 0; i < count; ++i )
+                    {
+                        WriteObject( elementType, elements + i * element.size, writer, pointers );
+                    }
+                }
+                else
+                {
+                    for ( size_t i = 0; i < count; ++i )
+                    {
+                        WriteValue( element, elements + i * element.size, writer, pointers );
+                    }
+                }
+            }
+            break;
+
+        case ValueKind::Class:
+            WriteObject( type.reflectedType(), static_cast< const uint8_t * >( value ), writer, pointers );
+            break;
+
+        case ValueKind::Pointer:
+            if ( pointers )
+            {
+                pointers->Write( type, value, writer );
+            }
+            break;
+
+        case ValueKind::Unsupported:
+            break;
+        }
+    }
+
+    bool ReadValue( const ValueType &type, void *value, BinaryReader &reader, PointerReader *pointers )
+    {
+        switch ( type.kind )
+        {
+        case ValueKind::Trivial:
+            return reader.Read( value, type.size );
+
+        case ValueKind::Sequence:
+            {
+                const ValueType &element = *type.element;
+                size_t count;
+
+                // every element takes at least a byte, unless it is a class without properties or a skipped pointer
+                const size_t minimumSize = element.kind == ValueKind::Trivial ? element.size :
+                                           element.kind == ValueKind::Pointer && !pointers ? 0 : 1;
+
+                if ( !reader.ReadCount( count ) || count * minimumSize > reader.GetRemaining() )
+                {
+                    return false;
+                }
+
+                uint8_t *elements = static_cast< uint8_t * >( type.resize( value, count ) );
+
+                if ( element.kind == ValueKind::Trivial )
+                {
+                    return reader.Read( elements, count * element.size );
+                }
+
+                const ITypeDescription *elementType = element.kind == ValueKind::Class ? element.reflectedType() : nullptr;
+
+                for ( size_t i = 0; i < count; ++i )
+                {
+                    if ( elementType ? !ReadObject( elementType, elements + i * element.size, reader, pointers ) :
+                                       !ReadValue( element, elements + i * element.size, reader, pointers ) )
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+        case ValueKind::Class:
+            return ReadObject( type.reflectedType(), static_cast< uint8_t * >( value ), reader, pointers );
+
+        case ValueKind::Pointer:
+            return !pointers || pointers->Read( type, value, reader );
+
+        case ValueKind::Unsupported:
+            return true;
+        }
+
+        return false;
+    }
+
+    void WriteObject( const ITypeDescription *type, const uint8_t *object, BinaryWriter &writer,
+                      PointerWriter *pointers )
+    {
+        for ( const PlanOp &op : type->GetPlan().GetOps() )
+        {
+            switch ( op.code )
+            {
+            case PlanOp::Code::Copy:
+                writer.Write( object + op.offset, op.size );
+                break;
+
+            case PlanOp::Code::Sequence:
+            case PlanOp::Code::Pointer:
+                WriteValue( *op.type, object + op.offset, writer, pointers );
+                break;
+
+            case PlanOp::Code::Property:
+                WriteValue( *op.type, op.property->Get( const_cast< uint8_t * >( object + op.offset ) ), writer,
+                            pointers );
+                break;
+            }
+        }
+    }
+
+    bool ReadObject( const ITypeDescription *type, uint8_t *object, BinaryReader &reader, PointerReader *pointers )
+    {
+        for ( const PlanOp &op : type->GetPlan().GetOps() )
+        {
+            bool read = true;
+
+            switch ( op.code )
+            {
+            case PlanOp::Code::Copy:
+                read = reader.Read( object + op.offset, op.size );
+                break;
+
+            case PlanOp::Code::Sequence:
+            case PlanOp::Code::Pointer:
+                read = ReadValue( *op.type, object + op.offset, reader, pointers );
+                break;
+
+            case PlanOp::Code::Property:
+                read = ReadValue( *op.type, op.property->Get( object + op.offset ), reader, pointers );
+                break;
+            }
+
+            if ( !read )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+void Reflect::Serialize( const ITypeDescription *type, const void *object, BinaryWriter &writer,
+                         PointerWriter *pointers )
+{
+    WriteObject( type, static_cast< const uint8_t * >( object ), writer, pointers );
+}
+
+bool Reflect::Deserialize( const ITypeDescription *type, void *object, BinaryReader &reader, PointerReader *pointers )
+{
+    return ReadObject( type, static_cast< uint8_t * >( object ), reader, pointers );
+}
+
+void Reflect::SerializeValue( const ValueType &type, const void *value, BinaryWriter &writer, PointerWriter *pointers )
+{
+    WriteValue( type, value, writer, pointers );
+}
+
+bool Reflect::DeserializeValue( const ValueType &type, void *value, BinaryReader &reader, PointerReader *pointers )
+{
+    return ReadValue( type, value, reader, pointers );
+}
\ No newline at end of file
@@ -0,0 +1,325 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/taggedSerializer.h"
+
+namespace
+{
+    enum
+    {
+        BaseClassKey = 0x01,
+        MaxInlineSize = 16
+    };
+
+    void WriteMessage( const ITypeDescription *type, const uint8_t *object, BinaryWriter &writer );
+
+    bool ReadMessage( const ITypeDescription *type, uint8_t *object, BinaryReader &reader );
+
+    /**
+     * Nested classes with reflected properties or base classes are written as tagged messages, also when they are
+     * trivially copyable, so their fields can evolve as well. Other trivially copyable values, such as scalars and
+     * aggregates that are not reflected, are copied byte for byte.
+     */
+    const ITypeDescription *GetMessageType( const ValueType &type )
+    {
+        if ( ( type.kind != ValueKind::Trivial && type.kind != ValueKind::Class ) || !type.reflectedType )
+        {
+            return nullptr;
+        }
+
+        const ITypeDescription *reflected = type.reflectedType();
+
+        return reflected->HasFlags( ITypeDescription::HasReflectedProperties ) ||
+               !reflected->GetBaseClasses().empty() ? reflected : nullptr;
+    }
+
+    // Writes the payload after room for the largest length, then moves it back against the actual length
+    template< typename tWrite >
+    void WriteDelimited( BinaryWriter &writer, tWrite write )
+    {
+        std::vector< uint8_t > &buffer = writer.GetBuffer();
+        const size_t start = buffer.size();
+
+        buffer.resize( start + BinaryWriter::MaxVarIntSize );
+        write();
+
+        const size_t length = buffer.size() - start - BinaryWriter::MaxVarIntSize;
+        const size_t lengthSize = BinaryWriter::EncodeVarInt( length, buffer.data() + start );
+
+        memmove( buffer.data() + start + lengthSize, buffer.data() + start + BinaryWriter::MaxVarIntSize, length );
+        buffer.resize( start + lengthSize + length );
+    }
+
+    void WritePayload( const ValueType &type, const void *value, BinaryWriter &writer )
+    {
+        if ( const ITypeDescription *message = GetMessageType( type ) )
+        {
+            WriteMessage( message, static_cast< const uint8_t * >( value ), writer );
+            return;
+        }
+
+        switch ( type.kind )
+        {
+        case ValueKind::Trivial:
+            writer.Write( value, type.size );
+            break;
+
+        case ValueKind::Sequence:
+            {
+                const ValueType &element = *type.element;
+                const size_t count = type.count( value );
+                const uint8_t *elements = static_cast< const uint8_t * >( type.data( value ) );
+
+                if ( element.kind == ValueKind::Trivial && !GetMessageType( element ) )
+                {
+                    writer.Write( elements, count * element.size );
+                    break;
+                }
+
+                for ( size_t i = 0; i < count; ++i )
+                {
+                    WriteDelimited( writer, [&]()
+                    {
+                        WritePayload( element, elements + i * element.size, writer );
+                    } );
+                }
+            }
+            break;
+
+        case ValueKind::Class:
+        case ValueKind::Pointer:
+        case ValueKind::Unsupported:
+            break;
+        }
+    }
+
+    void WriteMessage( const ITypeDescription *type, const uint8_t *object, BinaryWriter &writer )
+    {
+        for ( const ITypeDescription::BaseClass &base : type->GetBaseClasses() )
+        {
+            writer.WriteVarInt( ( static_cast< uint64_t >( static_cast< uint32_t >( base.index ) ) << 1 ) | BaseClassKey );
+
+            WriteDelimited( writer, [&]()
+            {
+                WriteMessage( base.type, object + base.offset, writer );
+            } );
+        }
+
+        if ( !type->GetProperties() )
+        {
+            return;
+        }
+
+        for ( const AbstractProperty *property : type->GetProperties()->GetDeclaredView() )
+        {
+            const ValueType &value = property->GetValueType();
+
+            if ( value.kind == ValueKind::Pointer || value.kind == ValueKind::Unsupported )
+            {
+                continue;
+            }
+
+            const void *address = property->HasOffset() ? object + property->GetOffset() :
+                                  property->Get( const_cast< uint8_t * >( object ) );
+
+            const uint64_t key = static_cast< uint64_t >( property->GetIndex() ) << 1;
+            const bool isRaw = value.kind == ValueKind::Trivial && !GetMessageType( value );
+
+            if ( isRaw && value.size <= MaxInlineSize )
+            {
+                // the key, length and payload of small fields are written at once
+                uint8_t field[2 * BinaryWriter::MaxVarIntSize + MaxInlineSize];
+                size_t size = BinaryWriter::EncodeVarInt( key, field );
+                size += BinaryWriter::EncodeVarInt( value.size, field + size );
+                memcpy( field + size, address, value.size );
+
+                writer.Write( field, size + value.size );
+                continue;
+            }
+
+            writer.WriteVarInt( key );
+
+            if ( isRaw )
+            {
+                writer.WriteVarInt( value.size );
+                writer.Write( address, value.size );
+                continue;
+            }
+
+            WriteDelimited( writer, [&]()
+            {
+                WritePayload( value, address, writer );
+            } );
+        }
+    }
+
+    // Reads a varint length and splits off a reader for the bytes it covers
+    bool ReadDelimited( BinaryReader &reader, BinaryReader &field )
+    {
+        uint64_t length;
+
+        if ( !reader.ReadVarInt( length ) || length > reader.GetRemaining() )
+        {
+            return false;
+        }
+
+        field = BinaryReader( reader.GetCursor(), static_cast< size_t >( length ) );
+        return reader.Skip( static_cast< size_t >( length ) );
+    }
+
+    bool ReadPayload( const ValueType &type, void *value, BinaryReader &reader )
+    {
+        if ( const ITypeDescription *message = GetMessageType( type ) )
+        {
+            return ReadMessage( message, static_cast< uint8_t * >( value ), reader );
+        }
+
+        switch ( type.kind )
+        {
+        case ValueKind::Trivial:
+            // a field whose size changed between versions is skipped
+            return reader.GetRemaining() != type.size || reader.Read( value, type.size );
+
+        case ValueKind::Sequence:
+            {
+                const ValueType &element = *type.element;
+
+                if ( element.kind == ValueKind::Trivial && !GetMessageType( element ) )
+                {
+                    if ( reader.GetRemaining() % element.size != 0 )
+                    {
+                        return false;
+                    }
+
+                    const size_t count = reader.GetRemaining() / element.size;
+                    return reader.Read( type.resize( value, count ), count * element.size );
+                }
+
+                // count the elements first, so the sequence is resized once
+                size_t count = 0;
+                BinaryReader counter = reader;
+                BinaryReader field( nullptr, 0 );
+
+                while ( counter.GetRemaining() > 0 )
+                {
+                    if ( !ReadDelimited( counter, field ) )
+                    {
+                        return false;
+                    }
+
+                    ++count;
+                }
+
+                uint8_t *elements = static_cast< uint8_t * >( type.resize( value, count ) );
+
+                for ( size_t i = 0; i < count; ++i )
+                {
+                    if ( !ReadDelimited( reader, field ) || !ReadPayload( element, elements + i * element.size, field ) )
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+        case ValueKind::Class:
+        case ValueKind::Pointer:
+        case ValueKind::Unsupported:
+            return true;
+        }
+
+        return false;
+    }
+
+    const ITypeDescription::BaseClass *FindBaseClass( const ITypeDescription *type, uint64_t index )
+    {
+        for ( const ITypeDescription::BaseClass &base : type->GetBaseClasses() )
+        {
+            if ( static_cast< uint32_t >( base.index ) == index )
+            {
+                return &base;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool ReadMessage( const ITypeDescription *type, uint8_t *object, BinaryReader &reader )
+    {
+        const AbstractProperties *properties = type->GetProperties();
+        BinaryReader field( nullptr, 0 );
+
+        while ( reader.GetRemaining() > 0 )
+        {
+            uint64_t key;
+
+            if ( !reader.ReadVarInt( key ) || !ReadDelimited( reader, field ) )
+            {
+                return false;
+            }
+
+            if ( key & BaseClassKey )
+            {
+                const ITypeDescription::BaseClass *base = FindBaseClass( type, key >> 1 );
+
+                if ( base && !ReadMessage( base->type, object + base->offset, field ) )
+                {
+                    return false;
+                }
+
+                continue;
+            }
+
+            AbstractProperty *property = properties ? properties->FindByIndex( static_cast< size_t >( key >> 1 ) ) : nullptr;
+
+            // unknown fields were skipped by splitting them off
+            if ( !property )
+            {
+                continue;
+            }
+
+            void *value = property->HasOffset() ? object + property->GetOffset() : property->Get( object );
+
+            if ( !ReadPayload( property->GetValueType(), value, field ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+void Reflect::SerializeTagged( const ITypeDescription *type, const void *object, BinaryWriter &writer )
+{
+    WriteMessage( type, static_cast< const uint8_t * >( object ), writer );
+}
+
+bool Reflect::DeserializeTagged( const ITypeDescription *type, void *object, BinaryReader &reader )
+{
+    return ReadMessage( type, static_cast< uint8_t * >( object ), reader );
+}
\ No newline at end of file
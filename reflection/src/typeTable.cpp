@@ -0,0 +1,71 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/typeTable.h"
+
+#include <algorithm>
+#include <assert.h>
+
+TypeTable::TypeTable()
+    : mChunkCount( 0 )
+{
+    mChunks.fill( nullptr );
+}
+
+TypeTable::~TypeTable()
+{
+    for ( size_t i = 0; i < mChunkCount; ++i )
+    {
+        delete[] mChunks[i];
+    }
+}
+
+ITypeDescription **TypeTable::GetSlot( size_t classId )
+{
+    const size_t chunk = classId >> ChunkBits;
+
+    assert( chunk < MaxChunks && "The type table is full, please increase REFLECTION_TYPE_TABLE_MAX_CHUNKS." );
+
+    while ( mChunkCount <= chunk )
+    {
+        mChunks[mChunkCount++] = new ITypeDescription *[ChunkSize]();
+    }
+
+    return &mChunks[chunk][classId & ( ChunkSize - 1 )];
+}
+
+size_t TypeTable::GetCapacity() const
+{
+    return mChunkCount * ChunkSize;
+}
+
+void TypeTable::Clear()
+{
+    for ( size_t i = 0; i < mChunkCount; ++i )
+    {
+        std::fill( mChunks[i], mChunks[i] + ChunkSize, nullptr );
+    }
+}
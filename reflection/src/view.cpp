@@ -0,0 +1,205 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/view.h"
+#include "reflection/hash.h"
+
+#include <string.h>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+    : mData( nullptr ),
+      mSize( 0 )
+{
+}
+
+MappedFile::MappedFile( const char *path )
+    : MappedFile()
+{
+    Open( path );
+}
+
+MappedFile::MappedFile( MappedFile &&other )
+    : mData( other.mData ),
+      mSize( other.mSize )
+{
+    other.mData = nullptr;
+    other.mSize = 0;
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open( const char *path )
+{
+    Close();
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+    const int file = open( path, O_RDONLY );
+
+    if ( file < 0 )
+    {
+        return false;
+    }
+
+    struct stat status;
+
+    if ( fstat( file, &status ) == 0 && status.st_size > 0 )
+    {
+        void *data = mmap( nullptr, static_cast< size_t >( status.st_size ), PROT_READ, MAP_SHARED, file, 0 );
+
+        if ( data != MAP_FAILED )
+        {
+            mData = static_cast< const uint8_t * >( data );
+            mSize = static_cast< size_t >( status.st_size );
+        }
+    }
+
+    // the mapping keeps its own reference to the file
+    close( file );
+#else
+    ( void )path;
+#endif
+
+    return IsOpen();
+}
+
+void MappedFile::Close()
+{
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+    if ( mData )
+    {
+        munmap( const_cast< uint8_t * >( mData ), mSize );
+    }
+
+#endif
+
+    mData = nullptr;
+    mSize = 0;
+}
+
+uint64_t ReflectionHelper::GetLayoutHash( const ITypeDescription *type, size_t recordSize )
+{
+    uint64_t hash = HashBytes( &recordSize, sizeof( recordSize ) );
+
+    // the stored bytes, including those of inlined class typed properties
+    for ( const PlanOp &op : type->GetPlan().GetOps() )
+    {
+        if ( op.code == PlanOp::Code::Copy )
+        {
+            const uint64_t run[2] = { op.offset, op.size };
+            hash = HashBytes( run, sizeof( run ), hash );
+        }
+    }
+
+    if ( type->GetProperties() )
+    {
+        for ( const AbstractProperty *property : type->GetProperties()->GetView() )
+        {
+            if ( property->HasOffset() )
+            {
+                const uint64_t layout[2] = { property->GetIndex(), property->GetOffset() };
+                hash = HashBytes( layout, sizeof( layout ), hash );
+            }
+        }
+    }
+
+    return hash;
+}
+
+void ReflectionHelper::WriteView( const ITypeDescription *type, const void *objects, size_t recordSize,
+                                  size_t recordAlignment, size_t count, std::vector< uint8_t > &buffer )
+{
+    assert( recordAlignment <= ViewHeader::DataOffset && "The records cannot be aligned in a view." );
+
+    ViewHeader header = {};
+    header.magic = ViewHeader::Magic;
+    header.version = ViewHeader::Version;
+    header.typeId = type->GetTypeID();
+    header.layoutHash = GetLayoutHash( type, recordSize );
+    header.recordSize = static_cast< uint32_t >( recordSize );
+    header.recordAlignment = static_cast< uint32_t >( recordAlignment );
+    header.count = count;
+
+    const size_t start = buffer.size();
+    buffer.resize( start + ViewHeader::DataOffset + count * recordSize );
+    memcpy( buffer.data() + start, &header, sizeof( header ) );
+
+    const ArrayView< PlanOp > ops = type->GetPlan().GetOps();
+    const uint8_t *object = static_cast< const uint8_t * >( objects );
+    uint8_t *record = buffer.data() + start + ViewHeader::DataOffset;
+
+    for ( size_t i = 0; i < count; ++i, object += recordSize, record += recordSize )
+    {
+        for ( const PlanOp &op : ops )
+        {
+            if ( op.code == PlanOp::Code::Copy )
+            {
+                memcpy( record + op.offset, object + op.offset, op.size );
+            }
+        }
+    }
+}
+
+const uint8_t *ReflectionHelper::ValidateView( const ITypeDescription *type, size_t recordSize, size_t recordAlignment,
+                                               const uint8_t *bytes, size_t size, size_t &count )
+{
+    ViewHeader header;
+
+    if ( !bytes || size < sizeof( header ) )
+    {
+        return nullptr;
+    }
+
+    memcpy( &header, bytes, sizeof( header ) );
+
+    if ( header.magic != ViewHeader::Magic || header.version != ViewHeader::Version ||
+         header.typeId != type->GetTypeID() || header.recordSize != recordSize ||
+         header.recordAlignment != recordAlignment || header.layoutHash != GetLayoutHash( type, recordSize ) )
+    {
+        return nullptr;
+    }
+
+    const uint8_t *records = bytes + ViewHeader::DataOffset;
+
+    if ( reinterpret_cast< uintptr_t >( records ) % recordAlignment != 0 ||
+         header.count > ( size - ViewHeader::DataOffset ) / recordSize )
+    {
+        return nullptr;
+    }
+
+    count = static_cast< size_t >( header.count );
+    return records;
+}
\ No newline at end of file
@@ -0,0 +1,230 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/clone.h"
+
+#include "helper.h"
+
+#include <string>
+#include <vector>
+#include <new>
+
+namespace
+{
+    class Gear
+    {
+    public:
+
+        uint8_t ratio;
+        uint32_t teeth;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "CloneGear" );
+
+            mirror.Reflect( &Gear::ratio, 0, "ratio" );
+            mirror.Reflect( &Gear::teeth, 1, "teeth" );
+        }
+    };
+
+    class Engine
+    {
+    public:
+
+        Engine()
+            : serial( 0 ),
+              owner( nullptr ),
+              cache( 7 )
+        {
+        }
+
+        uint64_t serial;
+        Gear gear;
+        std::string name;
+        std::vector< std::string > parts;
+        std::vector< Gear > gears;
+        const Engine *owner;
+
+        // Not reflected, so it is left alone
+        uint32_t cache;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "CloneEngine" );
+
+            mirror.Reflect( &Engine::serial, 0, "serial" );
+            mirror.Reflect( &Engine::gear, 1, "gear" );
+            mirror.Reflect( &Engine::name, 2, "name" );
+            mirror.Reflect( &Engine::parts, 3, "parts" );
+            mirror.Reflect( &Engine::gears, 4, "gears" );
+            mirror.Reflect( &Engine::owner, 5, "owner" );
+        }
+    };
+
+    // Members in both the base and the derived class, so the properties have no fixed offset
+    class Turbo
+        : public Engine
+    {
+    public:
+
+        std::string boost;
+        float pressure;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "CloneTurbo" );
+
+            mirror.Reflect< Turbo, Engine >( 0 );
+
+            mirror.Reflect( &Turbo::boost, 0, "boost" );
+            mirror.Reflect( &Turbo::pressure, 1, "pressure" );
+        }
+    };
+
+    Engine CreateEngine( uint64_t serial )
+    {
+        Engine engine;
+        engine.serial = serial;
+        engine.gear.ratio = 3;
+        engine.gear.teeth = 40;
+        engine.name = "a name long enough to be allocated on the heap";
+        engine.parts = { "piston", "valve", "crank" };
+        engine.gears.resize( 2 );
+        engine.gears[1].teeth = 12;
+        engine.owner = &engine;
+        engine.cache = 99;
+
+        return engine;
+    }
+
+    void ExpectEqual( const Engine &engine, const Engine &expected )
+    {
+        EXPECT_EQ( expected.serial, engine.serial );
+        EXPECT_EQ( expected.gear.ratio, engine.gear.ratio );
+        EXPECT_EQ( expected.gear.teeth, engine.gear.teeth );
+        EXPECT_EQ( expected.name, engine.name );
+        EXPECT_EQ( expected.parts, engine.parts );
+        ASSERT_EQ( expected.gears.size(), engine.gears.size() );
+        EXPECT_EQ( expected.gears[1].teeth, engine.gears[1].teeth );
+        EXPECT_EQ( expected.owner, engine.owner );
+    }
+
+    TEST( P( Clone ), Deep )
+    {
+        ReflectionClassTest< Engine > test;
+
+        const Engine source = CreateEngine( 11 );
+        Engine clone = Reflect::Clone( source );
+
+        ExpectEqual( clone, source );
+        EXPECT_EQ( 7u, clone.cache );
+
+        // the clone owns its strings and containers, while pointers are shared
+        clone.name[0] = 'A';
+        clone.parts[1] = "spring";
+        EXPECT_EQ( 'a', source.name[0] );
+        EXPECT_EQ( "valve", source.parts[1] );
+        EXPECT_EQ( &source, clone.owner );
+    }
+
+    TEST( P( Clone ), CopyInto )
+    {
+        ReflectionClassTest< Engine > test;
+
+        const Engine source = CreateEngine( 11 );
+        Engine destination = CreateEngine( 12 );
+        destination.parts.resize( 10 );
+        destination.cache = 5;
+
+        Reflect::CopyInto( destination, source );
+
+        ExpectEqual( destination, source );
+        EXPECT_EQ( 5u, destination.cache );
+    }
+
+    TEST( P( Clone ), Accessors )
+    {
+        ReflectionClassTest< Turbo > test;
+
+        ASSERT_FALSE( Reflect::GetType< Turbo >()->GetProperties()->GetDeclaredView()[0]->HasOffset() );
+
+        Turbo source;
+        static_cast< Engine & >( source ) = CreateEngine( 13 );
+        source.boost = "a boost long enough to be allocated on the heap";
+        source.pressure = 1.5f;
+
+        const Turbo clone = Reflect::Clone( source );
+
+        ExpectEqual( clone, source );
+        EXPECT_EQ( source.boost, clone.boost );
+        EXPECT_EQ( source.pressure, clone.pressure );
+    }
+
+    TEST( P( Clone ), Batch )
+    {
+        ReflectionClassTest< Engine > test;
+
+        std::vector< Engine > sources;
+
+        for ( uint64_t i = 0; i < 5; ++i )
+        {
+            sources.push_back( CreateEngine( i ) );
+        }
+
+        alignas( Engine ) uint8_t storage[5 * sizeof( Engine )];
+        Engine *clones = reinterpret_cast< Engine * >( storage );
+
+        ASSERT_TRUE( Reflect::CloneInto( clones, sources.data(), sources.size() ) );
+
+        for ( size_t i = 0; i < sources.size(); ++i )
+        {
+            ExpectEqual( clones[i], sources[i] );
+            clones[i].~Engine();
+        }
+    }
+
+    TEST( P( Clone ), BatchTrivial )
+    {
+        ReflectionClassTest< Gear > test;
+
+        Gear sources[3];
+
+        for ( uint8_t i = 0; i < 3; ++i )
+        {
+            sources[i].ratio = i;
+            sources[i].teeth = i * 10u;
+        }
+
+        Gear clones[3] = {};
+        Reflect::CopyInto( clones, sources, 3 );
+
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            EXPECT_EQ( sources[i].ratio, clones[i].ratio );
+            EXPECT_EQ( sources[i].teeth, clones[i].teeth );
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,204 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/compare.h"
+
+#include "helper.h"
+
+#include <unordered_set>
+#include <string>
+#include <vector>
+#include <new>
+
+namespace
+{
+    enum CompareFlags : uint32_t
+    {
+        Transient = 0x01
+    };
+
+    // Padding after every member
+    class Cell
+    {
+    public:
+
+        uint8_t kind;
+        uint32_t value;
+        uint16_t tag;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "CompareCell" );
+
+            mirror.Reflect( &Cell::kind, 0, "kind" );
+            mirror.Reflect( &Cell::value, 1, "value" );
+            mirror.Reflect( &Cell::tag, 2, "tag" );
+        }
+    };
+
+    class Key
+    {
+    public:
+
+        uint64_t id;
+        Cell cell;
+        std::string name;
+        std::vector< Cell > cells;
+        std::vector< std::string > path;
+        uint32_t hits;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "CompareKey" );
+
+            mirror.Reflect( &Key::id, 0, "id" );
+            mirror.Reflect( &Key::cell, 1, "cell" );
+            mirror.Reflect( &Key::name, 2, "name" );
+            mirror.Reflect( &Key::cells, 3, "cells" );
+            mirror.Reflect( &Key::path, 4, "path" );
+            mirror.Reflect( &Key::hits, 5, Transient, "hits" );
+        }
+    };
+
+    // Constructs the key in storage filled with the byte, so the padding holds different garbage every time
+    Key *CreateKey( void *storage, uint8_t garbage )
+    {
+        memset( storage, garbage, sizeof( Key ) );
+
+        Key *key = new( storage ) Key;
+        key->id = 42;
+        key->cell.kind = 1;
+        key->cell.value = 2;
+        key->cell.tag = 3;
+        key->name = "key";
+        key->cells.resize( 2 );
+        key->cells[0].kind = 4;
+        key->cells[0].value = 5;
+        key->cells[0].tag = 6;
+        key->cells[1] = key->cells[0];
+        key->path = { "a", "b" };
+        key->hits = 0;
+
+        return key;
+    }
+
+    TEST( P( Compare ), Padding )
+    {
+        ReflectionClassTest< Key > test;
+
+        alignas( Key ) uint8_t leftStorage[sizeof( Key )];
+        alignas( Key ) uint8_t rightStorage[sizeof( Key )];
+
+        Key *left = CreateKey( leftStorage, 0x00 );
+        Key *right = CreateKey( rightStorage, 0xff );
+
+        EXPECT_TRUE( Reflect::Equal( *left, *right ) );
+        EXPECT_EQ( Reflect::Hash( *left ), Reflect::Hash( *right ) );
+
+        left->~Key();
+        right->~Key();
+    }
+
+    TEST( P( Compare ), Differences )
+    {
+        ReflectionClassTest< Key > test;
+
+        alignas( Key ) uint8_t storage[sizeof( Key )];
+        Key *base = CreateKey( storage, 0x00 );
+        const uint64_t hash = Reflect::Hash( *base );
+
+        std::vector< Key > changed( 6, *base );
+        changed[0].id = 43;
+        changed[1].cell.tag = 4;
+        changed[2].name = "kez";
+        changed[3].cells[1].value = 0;
+        changed[4].path.back() = "c";
+        changed[5].path.push_back( "" );
+
+        for ( const Key &key : changed )
+        {
+            EXPECT_FALSE( Reflect::Equal( *base, key ) );
+            EXPECT_NE( hash, Reflect::Hash( key ) );
+        }
+
+        // nested sequences keep the elements apart
+        Key moved = *base;
+        moved.path = { "ab", "" };
+        EXPECT_NE( hash, Reflect::Hash( moved ) );
+
+        base->~Key();
+    }
+
+    TEST( P( Compare ), ExcludedFlags )
+    {
+        ReflectionClassTest< Key > test;
+
+        alignas( Key ) uint8_t storage[sizeof( Key )];
+        Key *base = CreateKey( storage, 0x00 );
+
+        Key counted = *base;
+        counted.hits = 100;
+
+        EXPECT_FALSE( Reflect::Equal( *base, counted ) );
+        EXPECT_NE( Reflect::Hash( *base ), Reflect::Hash( counted ) );
+        EXPECT_TRUE( Reflect::Equal( *base, counted, Transient ) );
+        EXPECT_EQ( Reflect::Hash( *base, Transient ), Reflect::Hash( counted, Transient ) );
+
+        std::unordered_set< Key, Reflect::Hasher< Key, Transient >, Reflect::EqualTo< Key, Transient > > keys;
+        keys.insert( *base );
+        keys.insert( counted );
+
+        EXPECT_EQ( 1, keys.size() );
+
+        base->~Key();
+    }
+
+    TEST( P( Compare ), Blocks )
+    {
+        std::vector< uint8_t > bytes( 1200 );
+
+        for ( size_t i = 0; i < bytes.size(); ++i )
+        {
+            bytes[i] = static_cast< uint8_t >( i * 131 + 7 );
+        }
+
+        // every lane, tail and scramble boundary, matching the portable version
+        for ( size_t size = 0; size < bytes.size(); size += 7 )
+        {
+            EXPECT_EQ( ReflectionHelper::HashBlocksScalar( bytes.data(), size, 9 ),
+                       ReflectionHelper::HashBlocks( bytes.data(), size, 9 ) ) << size;
+        }
+
+        const uint64_t hash = ReflectionHelper::HashBlocks( bytes.data(), bytes.size() );
+
+        for ( size_t i = 0; i < bytes.size(); i += 61 )
+        {
+            bytes[i] ^= 0x10;
+            EXPECT_NE( hash, ReflectionHelper::HashBlocks( bytes.data(), bytes.size() ) ) << i;
+            bytes[i] ^= 0x10;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,277 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/delta.h"
+
+#include "helper.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    class Vector3
+    {
+    public:
+
+        float x;
+        float y;
+        float z;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "DeltaVector3" );
+
+            mirror.Reflect( &Vector3::x, 0, "x" );
+            mirror.Reflect( &Vector3::y, 1, "y" );
+            mirror.Reflect( &Vector3::z, 2, "z" );
+        }
+    };
+
+    class Actor
+    {
+    public:
+
+        uint32_t id;
+        uint16_t team;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "DeltaActor" );
+
+            mirror.Reflect( &Actor::id, 0, "id" );
+            mirror.Reflect( &Actor::team, 1, "team" );
+        }
+    };
+
+    class Unit
+        : public Actor
+    {
+    public:
+
+        int32_t health;
+        int32_t armor;
+        double speed;
+        Vector3 position;
+        std::string name;
+        std::vector< uint32_t > targets;
+        std::vector< std::string > orders;
+        Unit *leader;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "DeltaUnit" );
+
+            mirror.Reflect< Unit, Actor >( 0 );
+
+            mirror.Reflect( &Unit::health, 0, "health" );
+            mirror.Reflect( &Unit::armor, 1, "armor" );
+            mirror.Reflect( &Unit::speed, 2, "speed" );
+            mirror.Reflect( &Unit::position, 3, "position" );
+            mirror.Reflect( &Unit::name, 4, "name" );
+            mirror.Reflect( &Unit::targets, 5, "targets" );
+            mirror.Reflect( &Unit::orders, 6, "orders" );
+            mirror.Reflect( &Unit::leader, 7, "leader" );
+        }
+    };
+
+    // A standard layout class, whose trivially copyable properties are compared as runs
+    class Body
+    {
+    public:
+
+        uint8_t kind;
+        uint32_t mass;
+        uint32_t charge;
+        Vector3 velocity;
+        uint64_t time;
+        std::string label;
+        uint16_t layer;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "DeltaBody" );
+
+            mirror.Reflect( &Body::kind, 0, "kind" );
+            mirror.Reflect( &Body::mass, 1, "mass" );
+            mirror.Reflect( &Body::charge, 2, "charge" );
+            mirror.Reflect( &Body::velocity, 3, "velocity" );
+            mirror.Reflect( &Body::time, 4, "time" );
+            mirror.Reflect( &Body::label, 5, "label" );
+            mirror.Reflect( &Body::layer, 6, "layer" );
+        }
+    };
+
+    Unit CreateUnit()
+    {
+        Unit unit;
+        unit.id = 17;
+        unit.team = 2;
+        unit.health = 100;
+        unit.armor = 50;
+        unit.speed = 1.5;
+        unit.position = { 1.0f, 2.0f, 3.0f };
+        unit.name = "scout";
+        unit.targets = { 1, 2, 3 };
+        unit.orders = { "move", "hold" };
+        unit.leader = nullptr;
+
+        return unit;
+    }
+
+    TEST( P( Delta ), Unchanged )
+    {
+        ReflectionClassTest< Unit > test;
+
+        const Unit unit = CreateUnit();
+        Unit copy = unit;
+        copy.leader = &copy;
+
+        std::vector< uint8_t > buffer;
+        EXPECT_FALSE( Reflect::WriteDelta( unit, copy, buffer ) );
+
+        // only the mask of the ten properties is written
+        EXPECT_EQ( 2, buffer.size() );
+        EXPECT_EQ( 0, buffer[0] );
+        EXPECT_EQ( 0, buffer[1] );
+
+        Unit target = unit;
+        EXPECT_TRUE( Reflect::ApplyDelta( target, buffer ) );
+        EXPECT_EQ( "scout", target.name );
+    }
+
+    TEST( P( Delta ), Changed )
+    {
+        ReflectionClassTest< Unit > test;
+
+        const Unit baseline = CreateUnit();
+        Unit current = baseline;
+        current.team = 3;
+        current.armor = 10;
+        current.position.y = -2.0f;
+        current.orders[1] = "attack";
+
+        std::vector< uint8_t > buffer;
+        ASSERT_TRUE( Reflect::WriteDelta( baseline, current, buffer ) );
+
+        // team, armor, position and orders
+        EXPECT_EQ( 0x02 | 0x08 | 0x20, buffer[0] );
+        EXPECT_EQ( 0x01, buffer[1] );
+
+        Unit target = baseline;
+        ASSERT_TRUE( Reflect::ApplyDelta( target, buffer ) );
+
+        EXPECT_EQ( 17, target.id );
+        EXPECT_EQ( 3, target.team );
+        EXPECT_EQ( 100, target.health );
+        EXPECT_EQ( 10, target.armor );
+        EXPECT_EQ( -2.0f, target.position.y );
+        EXPECT_EQ( 3.0f, target.position.z );
+        EXPECT_EQ( current.orders, target.orders );
+        EXPECT_EQ( baseline.targets, target.targets );
+
+        // applying the delta to a stale target only patches the changed properties
+        Unit stale = baseline;
+        stale.health = 1;
+        ASSERT_TRUE( Reflect::ApplyDelta( stale, buffer ) );
+        EXPECT_EQ( 1, stale.health );
+        EXPECT_EQ( 10, stale.armor );
+    }
+
+    TEST( P( Delta ), Sequences )
+    {
+        ReflectionClassTest< Unit > test;
+
+        const Unit baseline = CreateUnit();
+        Unit current = baseline;
+        current.targets.push_back( 4 );
+        current.name = "";
+
+        std::vector< uint8_t > buffer;
+        ASSERT_TRUE( Reflect::WriteDelta( baseline, current, buffer ) );
+
+        Unit target = baseline;
+        ASSERT_TRUE( Reflect::ApplyDelta( target, buffer ) );
+
+        EXPECT_TRUE( target.name.empty() );
+        EXPECT_EQ( current.targets, target.targets );
+        EXPECT_EQ( baseline.orders, target.orders );
+    }
+
+    TEST( P( Delta ), Invalid )
+    {
+        ReflectionClassTest< Unit > test;
+
+        const Unit baseline = CreateUnit();
+        Unit current = baseline;
+        current.speed = 2.0;
+        current.name = "renamed";
+
+        std::vector< uint8_t > buffer;
+        ASSERT_TRUE( Reflect::WriteDelta( baseline, current, buffer ) );
+
+        for ( size_t size = 0; size < buffer.size(); ++size )
+        {
+            Unit target = baseline;
+            EXPECT_FALSE( Reflect::ApplyDelta( target, buffer.data(), size ) );
+        }
+
+        // a bit past the last property
+        buffer[1] |= 0x80;
+
+        Unit target = baseline;
+        EXPECT_FALSE( Reflect::ApplyDelta( target, buffer ) );
+    }
+
+    TEST( P( Delta ), Runs )
+    {
+        ReflectionClassTest< Body > test;
+
+        ASSERT_TRUE( Reflect::GetType< Body >()->GetProperties()->GetView()[1]->HasOffset() );
+
+        Body baseline = { 1, 10, 20, { 1.0f, 2.0f, 3.0f }, 1000, "body", 4 };
+        Body current = baseline;
+        current.charge = 21;
+        current.velocity.z = 4.0f;
+        current.layer = 5;
+
+        std::vector< uint8_t > buffer;
+        ASSERT_TRUE( Reflect::WriteDelta( baseline, current, buffer ) );
+
+        // the mask, charge, velocity and layer
+        EXPECT_EQ( 0x04 | 0x08 | 0x40, buffer[0] );
+        EXPECT_EQ( 1 + sizeof( uint32_t ) + sizeof( Vector3 ) + sizeof( uint16_t ), buffer.size() );
+
+        Body target = baseline;
+        ASSERT_TRUE( Reflect::ApplyDelta( target, buffer ) );
+
+        EXPECT_EQ( 1, target.kind );
+        EXPECT_EQ( 21, target.charge );
+        EXPECT_EQ( 4.0f, target.velocity.z );
+        EXPECT_EQ( 1000, target.time );
+        EXPECT_EQ( 5, target.layer );
+    }
+}
\ No newline at end of file
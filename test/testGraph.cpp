@@ -0,0 +1,320 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/graph.h"
+
+#include "helper.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    class Tag
+    {
+    public:
+
+        uint32_t value;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "GraphTag" );
+
+            mirror.Reflect( &Tag::value, 0, "value" );
+        }
+    };
+
+    class Node
+    {
+    public:
+
+        Node()
+            : tag{ 0 },
+              next( nullptr ),
+              parent( nullptr )
+        {
+        }
+
+        Tag tag;
+        std::string name;
+        Node *next;
+        const Node *parent;
+        std::vector< Node * > children;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "GraphNode" );
+
+            mirror.Reflect( &Node::tag, 0, "tag" );
+            mirror.Reflect( &Node::name, 1, "name" );
+            mirror.Reflect( &Node::next, 2, "next" );
+            mirror.Reflect( &Node::parent, 3, "parent" );
+            mirror.Reflect( &Node::children, 4, "children" );
+        }
+    };
+
+    class Holder
+    {
+    public:
+
+        Node *node;
+        Tag *tag;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "GraphHolder" );
+
+            mirror.Reflect( &Holder::node, 0, "node" );
+            mirror.Reflect( &Holder::tag, 1, "tag" );
+        }
+    };
+
+    class alignas( 64 ) Wide
+    {
+    public:
+
+        uint64_t value;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "GraphWide" );
+
+            mirror.Reflect( &Wide::value, 0, "value" );
+        }
+    };
+
+    class Wides
+    {
+    public:
+
+        std::vector< Wide * > wides;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "GraphWides" );
+
+            mirror.Reflect( &Wides::wides, 0, "wides" );
+        }
+    };
+
+    TEST( P( Graph ), Sharing )
+    {
+        ReflectionClassTest< Node > test;
+
+        Node root;
+        Node left;
+        Node right;
+        Node shared;
+        root.name = "root";
+        left.name = "left";
+        right.name = "right";
+        shared.name = "shared";
+        shared.tag.value = 7;
+        root.children = { &left, &right, &shared };
+        left.next = &shared;
+        right.next = &shared;
+        left.parent = &root;
+        right.parent = &root;
+        shared.parent = &root;
+
+        std::vector< uint8_t > buffer;
+        ASSERT_TRUE( Reflect::WriteGraph( root, buffer ) );
+
+        ObjectArena arena;
+        Node loaded;
+        ASSERT_TRUE( Reflect::ReadGraph( buffer, loaded, arena ) );
+
+        EXPECT_EQ( "root", loaded.name );
+        ASSERT_EQ( 3u, loaded.children.size() );
+        EXPECT_EQ( "left", loaded.children[0]->name );
+        EXPECT_EQ( "right", loaded.children[1]->name );
+        EXPECT_EQ( "shared", loaded.children[2]->name );
+        EXPECT_EQ( 7u, loaded.children[2]->tag.value );
+        EXPECT_EQ( loaded.children[2], loaded.children[0]->next );
+        EXPECT_EQ( loaded.children[2], loaded.children[1]->next );
+        EXPECT_EQ( nullptr, loaded.children[2]->next );
+        EXPECT_EQ( nullptr, loaded.parent );
+
+        for ( const Node *child : loaded.children )
+        {
+            EXPECT_EQ( &loaded, child->parent );
+        }
+    }
+
+    TEST( P( Graph ), Cycles )
+    {
+        ReflectionClassTest< Node > test;
+
+        Node root;
+        Node other;
+        root.name = "root";
+        other.name = "other";
+        root.next = &other;
+        other.next = &root;
+        other.children = { &other, &root };
+
+        std::vector< uint8_t > buffer;
+        ASSERT_TRUE( Reflect::WriteGraph( root, buffer ) );
+
+        ObjectArena arena;
+        Node loaded;
+        ASSERT_TRUE( Reflect::ReadGraph( buffer, loaded, arena ) );
+
+        ASSERT_NE( nullptr, loaded.next );
+        EXPECT_EQ( "other", loaded.next->name );
+        EXPECT_EQ( &loaded, loaded.next->next );
+        ASSERT_EQ( 2u, loaded.next->children.size() );
+        EXPECT_EQ( loaded.next, loaded.next->children[0] );
+        EXPECT_EQ( &loaded, loaded.next->children[1] );
+    }
+
+    TEST( P( Graph ), LongChain )
+    {
+        ReflectionClassTest< Node > test;
+
+        // deep enough to overflow the stack if objects were written recursively
+        std::vector< Node > nodes( 100000 );
+
+        for ( size_t i = 0; i < nodes.size(); ++i )
+        {
+            nodes[i].tag.value = static_cast< uint32_t >( i );
+            nodes[i].next = i + 1 < nodes.size() ? &nodes[i + 1] : nullptr;
+        }
+
+        std::vector< uint8_t > buffer;
+        ASSERT_TRUE( Reflect::WriteGraph( nodes.front(), buffer ) );
+
+        ObjectArena arena( 4096 );
+        Node loaded;
+        ASSERT_TRUE( Reflect::ReadGraph( buffer, loaded, arena ) );
+
+        size_t count = 0;
+
+        for ( const Node *node = &loaded; node; node = node->next, ++count )
+        {
+            ASSERT_EQ( count, node->tag.value );
+        }
+
+        EXPECT_EQ( nodes.size(), count );
+    }
+
+    TEST( P( Graph ), Mismatch )
+    {
+        ReflectionClassTest< Holder > test;
+
+        // the tag lives at the address of the node, but is reached as another type
+        Node node;
+        Holder holder = { &node, &node.tag };
+
+        std::vector< uint8_t > buffer;
+        EXPECT_FALSE( Reflect::WriteGraph( holder, buffer ) );
+    }
+
+    TEST( P( Graph ), Malformed )
+    {
+        ReflectionClassTest< Node > test;
+
+        Node root;
+        Node other;
+        root.next = &other;
+        other.next = &root;
+
+        std::vector< uint8_t > buffer;
+        ASSERT_TRUE( Reflect::WriteGraph( root, buffer ) );
+
+        for ( size_t size = 0; size < buffer.size(); ++size )
+        {
+            ObjectArena arena;
+            Node loaded;
+            EXPECT_FALSE( Reflect::ReadGraph( buffer.data(), size, loaded, arena ) );
+        }
+
+        // the next pointer of the root, after the tag and the empty name, refers to an object not met yet
+        const size_t next = sizeof( Tag ) + sizeof( uint32_t );
+        ASSERT_EQ( 2u, buffer[next] );
+        buffer[next] = 5;
+
+        ObjectArena arena;
+        Node loaded;
+        EXPECT_FALSE( Reflect::ReadGraph( buffer, loaded, arena ) );
+    }
+
+    TEST( P( Graph ), Alignment )
+    {
+        ReflectionClassTest< Wides > test;
+
+        std::vector< Wide > storage( 50 );
+        Wides wides;
+
+        for ( size_t i = 0; i < storage.size(); ++i )
+        {
+            storage[i].value = i;
+            wides.wides.push_back( &storage[i] );
+        }
+
+        std::vector< uint8_t > buffer;
+        ASSERT_TRUE( Reflect::WriteGraph( wides, buffer ) );
+
+        // blocks smaller than an object, so every object gets a block of its own
+        ObjectArena arena( 100 );
+        Wides loaded;
+        ASSERT_TRUE( Reflect::ReadGraph( buffer, loaded, arena ) );
+        ASSERT_EQ( storage.size(), loaded.wides.size() );
+
+        for ( size_t i = 0; i < storage.size(); ++i )
+        {
+            EXPECT_EQ( 0u, reinterpret_cast< uintptr_t >( loaded.wides[i] ) % alignof( Wide ) );
+            EXPECT_EQ( i, loaded.wides[i]->value );
+        }
+    }
+
+    TEST( P( Graph ), ObjectTable )
+    {
+        std::vector< uint64_t > objects( 1000 );
+        ObjectTable table;
+
+        for ( size_t i = 0; i < objects.size(); ++i )
+        {
+            EXPECT_EQ( i, table.Insert( &objects[i], static_cast< uint32_t >( i ) ) );
+        }
+
+        EXPECT_EQ( 3u, table.Insert( &objects[3], 5000 ) );
+        EXPECT_EQ( objects.size(), table.GetSize() );
+
+        for ( size_t i = 0; i < objects.size(); ++i )
+        {
+            const uint32_t *id = table.Find( &objects[i] );
+            ASSERT_NE( nullptr, id );
+            EXPECT_EQ( i, *id );
+        }
+
+        uint64_t missing;
+        EXPECT_EQ( nullptr, table.Find( &missing ) );
+
+        table.Clear();
+        EXPECT_EQ( nullptr, table.Find( &objects[0] ) );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,198 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/reflection.h"
+
+#include "helper.h"
+
+namespace
+{
+    class FirstBase
+    {
+    public:
+
+        uint32_t first;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "FirstBase" );
+
+            mirror.Reflect( &FirstBase::first, 0, "first" );
+        }
+    };
+
+    class SecondBase
+    {
+    public:
+
+        float second;
+        uint64_t secondWide;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "SecondBase" );
+
+            mirror.Reflect( &SecondBase::second, 0, "second" );
+            mirror.Reflect( &SecondBase::secondWide, 1, "secondWide" );
+        }
+    };
+
+    class MultipleInheritance
+        : public FirstBase,
+          public SecondBase
+    {
+    public:
+
+        uint8_t own;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "MultipleInheritance" );
+
+            mirror.Reflect< MultipleInheritance, FirstBase >( 0 );
+            mirror.Reflect< MultipleInheritance, SecondBase >( 1 );
+
+            mirror.Reflect( &MultipleInheritance::own, 0, "own" );
+        }
+    };
+
+    class DeepInheritance
+        : public MultipleInheritance
+    {
+    public:
+
+        uint16_t deep;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "DeepInheritance" );
+
+            mirror.Reflect< DeepInheritance, MultipleInheritance >( 0 );
+
+            mirror.Reflect( &DeepInheritance::deep, 0, "deep" );
+        }
+    };
+
+    ptrdiff_t OffsetOf( const void *derived, const void *base )
+    {
+        return static_cast< const uint8_t * >( base ) - static_cast< const uint8_t * >( derived );
+    }
+
+    TEST( P( MultipleInheritance ), BaseClasses )
+    {
+        ReflectionClassTest< MultipleInheritance > test;
+
+        MultipleInheritance object;
+
+        ArrayView< ITypeDescription::BaseClass > bases = Reflect::GetType< MultipleInheritance >()->GetBaseClasses();
+
+        ASSERT_EQ( 2, bases.size() );
+        EXPECT_EQ( Reflect::GetType< FirstBase >(), bases[0].type );
+        EXPECT_EQ( Reflect::GetType< SecondBase >(), bases[1].type );
+        EXPECT_EQ( OffsetOf( &object, static_cast< FirstBase * >( &object ) ), bases[0].offset );
+        EXPECT_EQ( OffsetOf( &object, static_cast< SecondBase * >( &object ) ), bases[1].offset );
+        EXPECT_NE( 0, bases[1].offset );
+        EXPECT_EQ( 0, bases[0].index );
+        EXPECT_EQ( 1, bases[1].index );
+    }
+
+    TEST( P( MultipleInheritance ), InheritedProperties )
+    {
+        ReflectionClassTest< MultipleInheritance > test;
+
+        ArrayView< AbstractProperty * > properties = Reflect::GetType< MultipleInheritance >()->GetProperties()->GetView();
+
+        ASSERT_EQ( 4, properties.size() );
+        EXPECT_EQ( "first", properties[0]->GetName() );
+        EXPECT_EQ( "second", properties[1]->GetName() );
+        EXPECT_EQ( "secondWide", properties[2]->GetName() );
+        EXPECT_EQ( "own", properties[3]->GetName() );
+
+        MultipleInheritance object;
+        object.first = 1;
+        object.second = 2.0f;
+        object.secondWide = 3;
+        object.own = 4;
+
+        EXPECT_EQ( 1, properties[0]->Get< uint32_t >( object ) );
+        EXPECT_EQ( 2.0f, properties[1]->Get< float >( object ) );
+        EXPECT_EQ( 3, properties[2]->Get< uint64_t >( object ) );
+        EXPECT_EQ( 4, properties[3]->Get< uint8_t >( object ) );
+
+        properties[2]->Set( object, uint64_t( 30 ) );
+
+        EXPECT_EQ( 30, object.secondWide );
+        EXPECT_EQ( 2.0f, object.second );
+
+        // Records inherited from standard layout bases keep a byte offset, shifted by the base offset
+        ASSERT_TRUE( properties[2]->HasOffset() );
+        EXPECT_EQ( OffsetOf( &object, &object.secondWide ), properties[2]->GetOffset() );
+        EXPECT_EQ( 30, properties[2]->At< uint64_t >( &object ) );
+        EXPECT_FALSE( properties[3]->HasOffset() );
+    }
+
+    TEST( P( MultipleInheritance ), BaseUnaffected )
+    {
+        ReflectionClassTest< MultipleInheritance > test;
+
+        SecondBase base;
+        base.second = 5.0f;
+
+        ArrayView< AbstractProperty * > properties = Reflect::GetType< SecondBase >()->GetProperties()->GetView();
+
+        ASSERT_EQ( 2, properties.size() );
+        EXPECT_EQ( 5.0f, properties[0]->Get< float >( base ) );
+    }
+
+    TEST( P( DeepInheritance ), Ancestors )
+    {
+        ReflectionClassTest< DeepInheritance > test;
+
+        DeepInheritance object;
+        object.secondWide = 7;
+        object.deep = 8;
+
+        ArrayView< ITypeDescription::BaseClass > bases = Reflect::GetType< DeepInheritance >()->GetBaseClasses();
+        ArrayView< ITypeDescription::BaseClass > ancestors = Reflect::GetType< DeepInheritance >()->GetAncestors();
+
+        ASSERT_EQ( 1, bases.size() );
+        ASSERT_EQ( 3, ancestors.size() );
+        EXPECT_EQ( Reflect::GetType< MultipleInheritance >(), ancestors[0].type );
+        EXPECT_EQ( Reflect::GetType< FirstBase >(), ancestors[1].type );
+        EXPECT_EQ( Reflect::GetType< SecondBase >(), ancestors[2].type );
+        EXPECT_EQ( OffsetOf( &object, static_cast< SecondBase * >( &object ) ), ancestors[2].offset );
+
+        std::vector< Property< DeepInheritance, uint64_t > * > wide =
+            Reflect::GetType< DeepInheritance >()->GetProperties()->GetAll< uint64_t >();
+
+        ASSERT_EQ( 1, wide.size() );
+        EXPECT_EQ( 7, wide[0]->Get( object ) );
+
+        EXPECT_EQ( 5, Reflect::GetType< DeepInheritance >()->GetProperties()->GetAll().size() );
+        EXPECT_EQ( std::set< std::string >( { "first", "second", "secondWide", "own", "deep" } ),
+                   Reflect::GetType< DeepInheritance >()->GetProperties()->GetNames() );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,280 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/json.h"
+
+#include "helper.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    enum class Side : int8_t
+    {
+        Buy = 1,
+        Sell = -1
+    };
+
+    class Fill
+    {
+    public:
+
+        double price;
+        uint16_t quantity;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "JsonFill" );
+
+            mirror.Reflect( &Fill::price, 0, "price" );
+            mirror.Reflect( &Fill::quantity, 1, "quantity" );
+        }
+    };
+
+    class Entity
+    {
+    public:
+
+        uint64_t id;
+        std::string name;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "JsonEntity" );
+
+            mirror.Reflect( &Entity::id, 0, "id" );
+            mirror.Reflect( &Entity::name, 1, "name" );
+        }
+    };
+
+    class Trade
+        : public Entity
+    {
+    public:
+
+        int32_t delta;
+        float ratio;
+        bool active;
+        char code;
+        Side side;
+        std::string name;
+        std::vector< int64_t > levels;
+        std::vector< std::string > tags;
+        std::vector< Fill > fills;
+        Fill last;
+        Trade *next;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "JsonTrade" );
+
+            mirror.Reflect< Trade, Entity >( 0 );
+
+            mirror.Reflect( &Trade::delta, 0, "delta" );
+            mirror.Reflect( &Trade::ratio, 1, "ratio" );
+            mirror.Reflect( &Trade::active, 2, "active" );
+            mirror.Reflect( &Trade::code, 3, "code" );
+            mirror.Reflect( &Trade::side, 4, "side" );
+            mirror.Reflect( &Trade::name, 5, "name" );
+            mirror.Reflect( &Trade::levels, 6, "levels" );
+            mirror.Reflect( &Trade::tags, 7, "tags" );
+            mirror.Reflect( &Trade::fills, 8, "fills" );
+            mirror.Reflect( &Trade::last, 9, "last" );
+            mirror.Reflect( &Trade::next, 10, "next" );
+        }
+    };
+
+    Trade CreateTrade()
+    {
+        Trade trade;
+        trade.id = 1ull << 40;
+        trade.Entity::name = "hidden";
+        trade.delta = -12;
+        trade.ratio = 0.1f;
+        trade.active = true;
+        trade.code = 'X';
+        trade.side = Side::Sell;
+        trade.name = "quote \" slash \\ tab \t";
+        trade.levels = { 1, -2, 3 };
+        trade.tags = { "a", "" };
+        trade.fills = { { 1.5, 10 }, { 2.25, 20 } };
+        trade.last = { 0.125, 7 };
+        trade.next = nullptr;
+
+        return trade;
+    }
+
+    TEST( P( Json ), Write )
+    {
+        ReflectionClassTest< Trade > test;
+
+        std::string text;
+        Reflect::WriteJson( CreateTrade(), text );
+
+        EXPECT_EQ( "{\"id\":1099511627776,\"delta\":-12,\"ratio\":0.1,\"active\":true,\"code\":\"X\",\"side\":-1,"
+                   "\"name\":\"quote \\\" slash \\\\ tab \\t\",\"levels\":[1,-2,3],\"tags\":[\"a\",\"\"],"
+                   "\"fills\":[{\"price\":1.5,\"quantity\":10},{\"price\":2.25,\"quantity\":20}],"
+                   "\"last\":{\"price\":0.125,\"quantity\":7}}", text );
+    }
+
+    TEST( P( Json ), RoundTrip )
+    {
+        ReflectionClassTest< Trade > test;
+
+        const Trade trade = CreateTrade();
+
+        std::string text;
+        Reflect::WriteJson( trade, text );
+
+        Trade result;
+        result.levels = { 9, 9, 9, 9, 9 };
+        result.tags = { "stale" };
+        ASSERT_TRUE( Reflect::ReadJson( text, result ) );
+
+        EXPECT_EQ( trade.id, result.id );
+        EXPECT_EQ( -12, result.delta );
+        EXPECT_EQ( 0.1f, result.ratio );
+        EXPECT_TRUE( result.active );
+        EXPECT_EQ( 'X', result.code );
+        EXPECT_EQ( Side::Sell, result.side );
+        EXPECT_EQ( trade.name, result.name );
+        EXPECT_EQ( trade.levels, result.levels );
+        EXPECT_EQ( trade.tags, result.tags );
+        ASSERT_EQ( 2, result.fills.size() );
+        EXPECT_EQ( 2.25, result.fills[1].price );
+        EXPECT_EQ( 20, result.fills[1].quantity );
+        EXPECT_EQ( 7, result.last.quantity );
+    }
+
+    TEST( P( Json ), Read )
+    {
+        ReflectionClassTest< Trade > test;
+
+        const std::string text = " { \"unknown\" : { \"a\" : [ 1, { \"]\" : \"}\\\"\" } ], \"b\" : null },\n"
+                                 "\t\"delta\" : 5e0, \"levels\" : [ ], \"name\" : \"caf\\u00e9 \\ud83d\\ude00\",\n"
+                                 "\"id\" : 7, \"ratio\" : null, \"extra\" : [ [ [ ] ] ], \"code\" : \"\\n\" } ";
+
+        Trade result = CreateTrade();
+        EXPECT_FALSE( Reflect::ReadJson( text, result ) );
+
+        const std::string valid = " { \"unknown\" : { \"a\" : [ 1, { \"]\" : \"}\\\"\" } ], \"b\" : null },\n"
+                                  "\t\"delta\" : -5, \"levels\" : [ ], \"name\" : \"caf\\u00e9 \\ud83d\\ude00\",\n"
+                                  "\"id\" : 7, \"ratio\" : null, \"extra\" : [ [ [ ] ] ], \"code\" : \"\\n\" } ";
+
+        result = CreateTrade();
+        ASSERT_TRUE( Reflect::ReadJson( valid, result ) );
+
+        EXPECT_EQ( -5, result.delta );
+        EXPECT_TRUE( result.levels.empty() );
+        EXPECT_EQ( "caf\xc3\xa9 \xf0\x9f\x98\x80", result.name );
+        EXPECT_EQ( 7, result.id );
+        EXPECT_EQ( 0.1f, result.ratio );
+        EXPECT_EQ( '\n', result.code );
+        EXPECT_EQ( "hidden", result.Entity::name );
+    }
+
+    TEST( P( Json ), Invalid )
+    {
+        ReflectionClassTest< Trade > test;
+
+        const char *documents[] =
+        {
+            "",
+            "[]",
+            "{",
+            "{\"delta\":1,}",
+            "{\"delta\" 1}",
+            "{\"delta\":1]",
+            "{\"delta\":1} {}",
+            "{\"delta\":tru}",
+            "{\"delta\":\"1\"}",
+            "{\"delta\":1.5}",
+            "{\"delta\":3000000000}",
+            "{\"fills\":[{\"quantity\":-1}]}",
+            "{\"name\":\"unterminated}",
+            "{\"name\":\"\\x\"}",
+            "{\"name\":\"\\udc00\"}",
+            "{\"unknown\":[{]}",
+        };
+
+        for ( const char *document : documents )
+        {
+            Trade result;
+            EXPECT_FALSE( Reflect::ReadJson( document, result ) ) << document;
+        }
+    }
+
+    TEST( P( Json ), Tokens )
+    {
+        JsonReader reader( "{\"a\":[1,\"b\",true,false,null],\"c\":{}}" );
+
+        const JsonToken expected[] =
+        {
+            JsonToken::BeginObject, JsonToken::Key, JsonToken::BeginArray, JsonToken::Number, JsonToken::String,
+            JsonToken::True, JsonToken::False, JsonToken::Null, JsonToken::EndArray, JsonToken::Key,
+            JsonToken::BeginObject, JsonToken::EndObject, JsonToken::EndObject, JsonToken::End
+        };
+
+        for ( JsonToken token : expected )
+        {
+            EXPECT_EQ( token, reader.Next() );
+        }
+
+        EXPECT_FALSE( reader.HasError() );
+    }
+
+    TEST( P( Json ), Scanner )
+    {
+        // every position inside and around a vector width
+        for ( size_t length = 0; length < 40; ++length )
+        {
+            for ( size_t position = 0; position <= length; ++position )
+            {
+                std::string text( length, 'a' );
+
+                if ( position < length )
+                {
+                    text[position] = '\x01';
+                }
+
+                const char *end = text.data() + text.size();
+
+                EXPECT_EQ( text.data() + position, ReflectionHelper::FindStringSpecial( text.data(), end ) );
+
+                if ( position < length )
+                {
+                    text[position] = '[';
+                }
+
+                EXPECT_EQ( text.data() + position, ReflectionHelper::FindStructural( text.data(), end ) );
+            }
+        }
+
+        const std::string text = "{ z ; ] \xfb \x7f";
+        EXPECT_EQ( text.data() + 6, ReflectionHelper::FindStructural( text.data() + 1, text.data() + text.size() ) );
+    }
+}
\ No newline at end of file
@@ -330,5 +330,416 @@ namespace
         EXPECT_TRUE( properties->GetIndices().empty() );
     }
 
+    class NamedProperties
+    {
+    public:
+
+        uint32_t first;
+        float second;
+        uint8_t third;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "NamedProperties" );
+
+            mirror.Reflect( &NamedProperties::third, 7, "third" );
+            mirror.Reflect( &NamedProperties::first, 3, "first", "The first property" );
+            mirror.Reflect( &NamedProperties::second, 5, "second" );
+        }
+    };
+
+    TEST( P( NamedProperties ), Names )
+    {
+        ReflectionClassTest< NamedProperties > test;
+
+        std::set< std::string > names = Reflect::GetType<NamedProperties>()->GetProperties()->GetNames();
+
+        EXPECT_EQ( std::set< std::string >( { "first", "second", "third" } ), names );
+    }
+
+    TEST( P( NamedProperties ), DeclarationOrder )
+    {
+        ReflectionClassTest< NamedProperties > test;
+
+        std::vector< AbstractProperty * > properties = Reflect::GetType<NamedProperties>()->GetProperties()->GetAll();
+
+        ASSERT_EQ( 3, properties.size() );
+        EXPECT_EQ( 7, properties[0]->GetIndex() );
+        EXPECT_EQ( 3, properties[1]->GetIndex() );
+        EXPECT_EQ( 5, properties[2]->GetIndex() );
+
+        EXPECT_EQ( "The first property", properties[1]->GetDescription() );
+    }
+
+    TEST( P( NamedProperties ), Lookups )
+    {
+        ReflectionClassTest< NamedProperties > test;
+
+        const Properties< NamedProperties > *properties = Reflect::GetType<NamedProperties>()->GetProperties();
+
+        EXPECT_EQ( properties->Get< uint32_t >( 3 ), properties->GetByMemberPtr( &NamedProperties::first ) );
+        EXPECT_EQ( properties->Get< float >( 5 ), properties->GetByMemberPtr( &NamedProperties::second ) );
+        EXPECT_EQ( properties->Get< uint8_t >( 7 ), properties->GetByMemberPtr( &NamedProperties::third ) );
+
+        EXPECT_EQ( "second", properties->Get< float >( 5 )->GetName() );
+
+        EXPECT_THROW( properties->Get< uint32_t >( 4 ), std::out_of_range );
+    }
+
+    TEST( P( NamedProperties ), ContiguousStorage )
+    {
+        ReflectionClassTest< NamedProperties > test;
+
+        std::vector< AbstractProperty * > properties = Reflect::GetType<NamedProperties>()->GetProperties()->GetAll();
+
+        const uint8_t *first = reinterpret_cast< const uint8_t * >( properties[0] );
+        const uint8_t *second = reinterpret_cast< const uint8_t * >( properties[1] );
+        const uint8_t *third = reinterpret_cast< const uint8_t * >( properties[2] );
+
+        EXPECT_LT( first, second );
+        EXPECT_LT( second, third );
+        EXPECT_EQ( second - first, third - second );
+        EXPECT_GE( static_cast< size_t >( second - first ), sizeof( Property< NamedProperties, uint32_t > ) );
+    }
+
+    TEST( P( NamedProperties ), ByteOffsets )
+    {
+        ReflectionClassTest< NamedProperties > test;
+
+        const Properties< NamedProperties > *properties = Reflect::GetType<NamedProperties>()->GetProperties();
+        const AbstractProperty *first = properties->Get< uint32_t >( 3 );
+        const AbstractProperty *second = properties->Get< float >( 5 );
+        const AbstractProperty *third = properties->Get< uint8_t >( 7 );
+
+        ASSERT_TRUE( first->HasOffset() );
+        EXPECT_EQ( offsetof( NamedProperties, first ), first->GetOffset() );
+        EXPECT_EQ( offsetof( NamedProperties, second ), second->GetOffset() );
+        EXPECT_EQ( offsetof( NamedProperties, third ), third->GetOffset() );
+
+        EXPECT_EQ( sizeof( uint32_t ), first->GetSize() );
+        EXPECT_EQ( sizeof( uint8_t ), third->GetSize() );
+        EXPECT_TRUE( second->IsTriviallyCopyable() );
+
+        NamedProperties source = { 42, 1.5f, 7 };
+        NamedProperties destination = { 0, 0.0f, 0 };
+
+        EXPECT_EQ( 42u, first->At< uint32_t >( &source ) );
+        EXPECT_EQ( 1.5f, second->At< float >( &source ) );
+
+        second->CopyValue( &destination, &source );
+        third->CopyValue( &destination, &source );
+
+        EXPECT_EQ( 0u, destination.first );
+        EXPECT_EQ( 1.5f, destination.second );
+        EXPECT_EQ( 7, destination.third );
+    }
+
+    TEST( P( SimplePropertiesBasicRegistration ), NoByteOffsets )
+    {
+        ReflectionClassTest< SimplePropertiesBasicRegistration > test;
+
+        for ( AbstractProperty *property : Reflect::GetType<SimplePropertiesBasicRegistration>()->GetProperties()->GetAll() )
+        {
+            EXPECT_FALSE( property->HasOffset() );
+        }
+    }
+
+    TEST( P( NamedProperties ), GatherScatter )
+    {
+        ReflectionClassTest< NamedProperties > test;
+
+        const Properties< NamedProperties > *properties = Reflect::GetType<NamedProperties>()->GetProperties();
+
+        std::vector< NamedProperties > objects( 37 );
+
+        for ( size_t i = 0; i < objects.size(); ++i )
+        {
+            objects[i] = { static_cast< uint32_t >( i ), i * 0.5f, static_cast< uint8_t >( i * 3 ) };
+        }
+
+        std::vector< float > seconds = properties->GetByMemberPtr( &NamedProperties::second )->Gather( objects );
+        std::vector< uint8_t > thirds( objects.size() );
+        properties->Get< uint8_t >( 7 )->Gather( objects.data(), objects.size(), thirds.data() );
+
+        ASSERT_EQ( objects.size(), seconds.size() );
+
+        for ( size_t i = 0; i < objects.size(); ++i )
+        {
+            EXPECT_EQ( i * 0.5f, seconds[i] );
+            EXPECT_EQ( static_cast< uint8_t >( i * 3 ), thirds[i] );
+            seconds[i] = -1.0f * i;
+        }
+
+        properties->GetByMemberPtr( &NamedProperties::second )->Scatter( seconds, objects );
+
+        for ( size_t i = 0; i < objects.size(); ++i )
+        {
+            EXPECT_EQ( -1.0f * i, objects[i].second );
+            EXPECT_EQ( i, objects[i].first );
+        }
+    }
+
+    class StringProperties
+    {
+    public:
+
+        std::string text;
+        uint64_t wide;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( &StringProperties::text, 0, "text" );
+            mirror.Reflect( &StringProperties::wide, 1, "wide" );
+        }
+    };
+
+    TEST( P( StringProperties ), GatherScatter )
+    {
+        ReflectionClassTest< StringProperties > test;
+
+        const Properties< StringProperties > *properties = Reflect::GetType<StringProperties>()->GetProperties();
+
+        std::vector< StringProperties > objects( 9 );
+
+        for ( size_t i = 0; i < objects.size(); ++i )
+        {
+            objects[i].text = std::to_string( i );
+            objects[i].wide = i << 40;
+        }
+
+        EXPECT_FALSE( properties->Get< std::string >( 0 )->IsTriviallyCopyable() );
+
+        std::vector< std::string > texts = properties->Get< std::string >( 0 )->Gather( objects );
+        std::vector< uint64_t > wides( objects.size() );
+        properties->Get< uint64_t >( 1 )->Gather( objects.data(), sizeof( StringProperties ), objects.size(), wides.data() );
+
+        for ( size_t i = 0; i < objects.size(); ++i )
+        {
+            EXPECT_EQ( std::to_string( i ), texts[i] );
+            EXPECT_EQ( i << 40, wides[i] );
+            texts[i] += "!";
+        }
+
+        properties->Get< std::string >( 0 )->Scatter( texts, objects );
+
+        EXPECT_EQ( "8!", objects[8].text );
+    }
+
+    enum FieldFlags : uint32_t
+    {
+        Transient = 0x01,
+        Replicated = 0x02,
+        Indexed = 0x80000000
+    };
+
+    struct Range
+    {
+        float minimum;
+        float maximum;
+    };
+
+    class FlaggedBase
+    {
+    public:
+
+        uint32_t id;
+        float health;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "FlaggedBase" );
+
+            mirror.Reflect( &FlaggedBase::id, 0, Replicated | Indexed, "id" );
+            mirror.Reflect( &FlaggedBase::health, 1, Accessibility::Protected, Replicated, "health" );
+            mirror.Attribute( &FlaggedBase::health, Range{ 0.0f, 100.0f } );
+            mirror.Attribute( &FlaggedBase::health, std::string( "Health" ) );
+        }
+    };
+
+    class Flagged
+        : public FlaggedBase
+    {
+    public:
+
+        uint32_t cache;
+        float speed;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Flagged" );
+
+            mirror.Reflect< Flagged, FlaggedBase >( 0 );
+
+            mirror.Reflect( &Flagged::cache, 0, Transient, "cache" );
+            mirror.Reflect( &Flagged::speed, 1, Accessibility::Private, Replicated, "speed" );
+            mirror.Attribute( &Flagged::speed, Range{ -1.0f, 1.0f } );
+        }
+    };
+
+    TEST( P( Flagged ), FlaggedView )
+    {
+        ReflectionClassTest< Flagged > test;
+
+        const Properties< Flagged > *properties = Reflect::GetType< Flagged >()->GetProperties();
+
+        ArrayView< AbstractProperty * > replicated = properties->GetFlaggedView( Replicated );
+        ASSERT_EQ( 3u, replicated.size() );
+        EXPECT_STREQ( "id", replicated[0]->GetCName() );
+        EXPECT_STREQ( "health", replicated[1]->GetCName() );
+        EXPECT_STREQ( "speed", replicated[2]->GetCName() );
+        EXPECT_EQ( Accessibility::Private, replicated[2]->GetAccessibility() );
+
+        ArrayView< AbstractProperty * > transient = properties->GetFlaggedView( Transient );
+        ASSERT_EQ( 1u, transient.size() );
+        EXPECT_STREQ( "cache", transient[0]->GetCName() );
+
+        ArrayView< AbstractProperty * > indexed = properties->GetFlaggedView( Indexed );
+        ASSERT_EQ( 1u, indexed.size() );
+        EXPECT_TRUE( indexed[0]->HasCustomFlags( Replicated | Indexed ) );
+
+        EXPECT_TRUE( properties->GetFlaggedView( 0x04 ).empty() );
+        EXPECT_EQ( 2u, Reflect::GetType< FlaggedBase >()->GetProperties()->GetFlaggedView( Replicated ).size() );
+    }
+
+    TEST( P( Flagged ), Attributes )
+    {
+        ReflectionClassTest< Flagged > test;
+
+        const Properties< Flagged > *properties = Reflect::GetType< Flagged >()->GetProperties();
+
+        const AbstractProperty *health = properties->FindByName( "health" );
+        ASSERT_NE( nullptr, health->GetAttribute< Range >() );
+        EXPECT_EQ( 100.0f, health->GetAttribute< Range >()->maximum );
+        ASSERT_NE( nullptr, health->GetAttribute< std::string >() );
+        EXPECT_EQ( "Health", *health->GetAttribute< std::string >() );
+
+        const AbstractProperty *speed = properties->FindByName( "speed" );
+        ASSERT_NE( nullptr, speed->GetAttribute< Range >() );
+        EXPECT_EQ( -1.0f, speed->GetAttribute< Range >()->minimum );
+        EXPECT_EQ( nullptr, speed->GetAttribute< std::string >() );
+        EXPECT_EQ( nullptr, properties->FindByName( "cache" )->GetAttribute< Range >() );
+
+        // the inherited copy shares the attribute of the base class
+        EXPECT_EQ( Reflect::GetType< FlaggedBase >()->GetProperties()->FindByName( "health" )->GetAttribute< Range >(),
+                   health->GetAttribute< Range >() );
+    }
+
+    class AccessibleBase
+    {
+    public:
+
+        uint32_t a;
+        uint32_t b;
+        uint32_t c;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "AccessibleBase" );
+
+            mirror.Reflect( &AccessibleBase::a, 0, Accessibility::Private, "a" );
+            mirror.Reflect( &AccessibleBase::b, 1, Accessibility::Public, "b" );
+            mirror.Reflect( &AccessibleBase::c, 2, Accessibility::Protected, "c" );
+        }
+    };
+
+    class Accessible
+        : public AccessibleBase
+    {
+    public:
+
+        uint32_t d;
+        uint64_t e;
+        uint32_t f;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Accessible" );
+
+            mirror.Reflect< Accessible, AccessibleBase >( 0 );
+
+            mirror.Reflect( &Accessible::d, 0, Accessibility::Public, "d" );
+            mirror.Reflect( &Accessible::e, 1, Accessibility::Private, "e" );
+            mirror.Reflect( &Accessible::f, 2, Accessibility::Public, "f" );
+        }
+    };
+
+    std::string GetNames( ArrayView< AbstractProperty * > properties )
+    {
+        std::string names;
+
+        for ( AbstractProperty *property : properties )
+        {
+            names += property->GetCName();
+        }
+
+        return names;
+    }
 
+    TEST( P( Accessible ), AccessibleView )
+    {
+        ReflectionClassTest< Accessible > test;
+
+        typedef AbstractProperties::AccessibilityType Type;
+        const AbstractProperties *properties = Reflect::GetType< Accessible >()->GetProperties();
+
+        EXPECT_EQ( "bdf", GetNames( properties->GetAccessibleView( Accessibility::Public, Type::Exclusive ) ) );
+        EXPECT_EQ( "c", GetNames( properties->GetAccessibleView( Accessibility::Protected, Type::Exclusive ) ) );
+        EXPECT_EQ( "ae", GetNames( properties->GetAccessibleView( Accessibility::Private, Type::Exclusive ) ) );
+
+        EXPECT_EQ( "bdf", GetNames( properties->GetAccessibleView( Accessibility::Public, Type::DownTo ) ) );
+        EXPECT_EQ( "bdfc", GetNames( properties->GetAccessibleView( Accessibility::Protected ) ) );
+        EXPECT_EQ( "bdfcae", GetNames( properties->GetAccessibleView( Accessibility::Private, Type::DownTo ) ) );
+
+        EXPECT_EQ( "bdfcae", GetNames( properties->GetAccessibleView( Accessibility::Public, Type::UpTo ) ) );
+        EXPECT_EQ( "cae", GetNames( properties->GetAccessibleView( Accessibility::Protected, Type::UpTo ) ) );
+        EXPECT_EQ( "ae", GetNames( properties->GetAccessibleView( Accessibility::Private, Type::UpTo ) ) );
+
+        EXPECT_EQ( "cae", GetNames( properties->GetAccessibleView( Accessibility::Public, Type::NotEqual ) ) );
+        EXPECT_EQ( "aebdf", GetNames( properties->GetAccessibleView( Accessibility::Protected, Type::NotEqual ) ) );
+        EXPECT_EQ( "bdfc", GetNames( properties->GetAccessibleView( Accessibility::Private, Type::NotEqual ) ) );
+
+        EXPECT_EQ( properties->GetAccessibleView( Accessibility::Protected, Type::NotEqual ).ToVector(),
+                   properties->GetAll( Accessibility::Protected, Type::NotEqual ) );
+
+        const AbstractProperties *base = Reflect::GetType< AccessibleBase >()->GetProperties();
+        EXPECT_EQ( "ab", GetNames( base->GetAccessibleView( Accessibility::Protected, Type::NotEqual ) ) );
+    }
+
+    TEST( P( Accessible ), TypedAccessibility )
+    {
+        ReflectionClassTest< Accessible > test;
+
+        typedef AbstractProperties::AccessibilityType Type;
+        const Properties< Accessible > *properties = Reflect::GetType< Accessible >()->GetProperties();
+
+        EXPECT_EQ( "ca", GetNames( properties->GetTypedView< uint32_t >( Accessibility::Public, Type::NotEqual ) ) );
+        EXPECT_EQ( "abdf", GetNames( properties->GetTypedView< uint32_t >( Accessibility::Protected, Type::NotEqual ) ) );
+        EXPECT_EQ( "bdfca", GetNames( properties->GetTypedView< uint32_t >( Accessibility::Public, Type::UpTo ) ) );
+        EXPECT_EQ( "bdfc", GetNames( properties->GetTypedView< uint32_t >( Accessibility::Protected ) ) );
+
+        EXPECT_EQ( "e", GetNames( properties->GetTypedView< uint64_t >( Accessibility::Private, Type::Exclusive ) ) );
+        EXPECT_TRUE( properties->GetTypedView< uint64_t >( Accessibility::Protected ).empty() );
+        EXPECT_TRUE( properties->GetTypedView< float >( Accessibility::Private ).empty() );
+    }
+
+    TEST( P( Accessible ), TypedView )
+    {
+        ReflectionClassTest< Accessible > test;
+
+        const Properties< Accessible > *properties = Reflect::GetType< Accessible >()->GetProperties();
+
+        EXPECT_EQ( "abcdf", GetNames( properties->GetTypedView< uint32_t >() ) );
+        EXPECT_EQ( "e", GetNames( properties->GetTypedView( ValueType::Get< uint64_t >() ) ) );
+        EXPECT_TRUE( properties->GetTypedView< float >().empty() );
+
+        std::vector< Property< Accessible, uint32_t > * > all = properties->GetAll< uint32_t >();
+        ASSERT_EQ( 5u, all.size() );
+        EXPECT_STREQ( "a", all[0]->GetCName() );
+        EXPECT_STREQ( "f", all[4]->GetCName() );
+
+        Accessible object;
+        object.d = 42;
+
+        EXPECT_EQ( 42u, properties->GetTypedView< uint32_t >()[3]->Get< uint32_t >( object ) );
+    }
 }
\ No newline at end of file
@@ -0,0 +1,152 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/reflectedVector.h"
+
+#include "helper.h"
+
+#include <string>
+
+namespace
+{
+    class Scored
+    {
+    public:
+
+        uint32_t id;
+        float score;
+        std::string label;
+        uint64_t unreflected;
+
+        Scored()
+            : id( 0 ),
+              score( 0.0f ),
+              unreflected( 42 )
+        {
+        }
+
+        Scored( uint32_t i, float s, const std::string &l )
+            : id( i ),
+              score( s ),
+              label( l ),
+              unreflected( 7 )
+        {
+        }
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Scored" );
+
+            mirror.Reflect( &Scored::id, 0, "id" );
+            mirror.Reflect( &Scored::score, 1, "score" );
+            mirror.Reflect( &Scored::label, 2, "label" );
+        }
+    };
+
+    TEST( P( ReflectedVector ), Columns )
+    {
+        ReflectionClassTest< Scored > test;
+
+        ReflectedVector< Scored > vector;
+
+        for ( uint32_t i = 0; i < 100; ++i )
+        {
+            vector.push_back( Scored( i, i * 0.25f, std::to_string( i ) ) );
+        }
+
+        ASSERT_EQ( 100, vector.size() );
+        EXPECT_EQ( 3, vector.GetColumnCount() );
+        EXPECT_GE( vector.capacity(), 100 );
+
+        const float *scores = vector.GetColumnByMemberPtr( &Scored::score );
+        const uint32_t *ids = vector.GetColumn< uint32_t >( 0 );
+
+        EXPECT_EQ( 0, reinterpret_cast< uintptr_t >( scores ) % REFLECTION_COLUMN_ALIGNMENT );
+
+        float sum = 0.0f;
+
+        for ( size_t i = 0; i < vector.size(); ++i )
+        {
+            EXPECT_EQ( i, ids[i] );
+            sum += scores[i];
+        }
+
+        EXPECT_EQ( 1237.5f, sum );
+        EXPECT_EQ( "99", vector.GetColumnByMemberPtr( &Scored::label )[99] );
+    }
+
+    TEST( P( ReflectedVector ), Rows )
+    {
+        ReflectionClassTest< Scored > test;
+
+        ReflectedVector< Scored > vector;
+        vector.push_back( Scored( 1, 1.5f, "one" ) );
+        vector.push_back( Scored( 2, 2.5f, "two" ) );
+
+        vector[1][&Scored::score] = 3.0f;
+        vector[0].Get< std::string >( 2 ) = "first";
+
+        Scored second = vector[1];
+        EXPECT_EQ( 2, second.id );
+        EXPECT_EQ( 3.0f, second.score );
+        EXPECT_EQ( "two", second.label );
+        EXPECT_EQ( 42, second.unreflected );
+
+        vector[1] = Scored( 5, 5.5f, "five" );
+
+        EXPECT_EQ( "first", vector.Get( 0 ).label );
+        EXPECT_EQ( 5, vector[1][&Scored::id] );
+        EXPECT_EQ( "five", vector[1][&Scored::label] );
+    }
+
+    TEST( P( ReflectedVector ), Erase )
+    {
+        ReflectionClassTest< Scored > test;
+
+        ReflectedVector< Scored > vector;
+        vector.reserve( 4 );
+        EXPECT_EQ( 4, vector.capacity() );
+
+        for ( uint32_t i = 0; i < 5; ++i )
+        {
+            vector.push_back( Scored( i, 0.0f, std::string( 32, static_cast< char >( 'a' + i ) ) ) );
+        }
+
+        vector.erase( 1 );
+
+        ASSERT_EQ( 4, vector.size() );
+        EXPECT_EQ( 2, vector[1][&Scored::id] );
+        EXPECT_EQ( std::string( 32, 'c' ), vector[1][&Scored::label] );
+        EXPECT_EQ( 4, vector[3][&Scored::id] );
+        EXPECT_EQ( std::string( 32, 'e' ), vector[3][&Scored::label] );
+
+        vector.pop_back();
+        EXPECT_EQ( 3, vector.size() );
+
+        vector.clear();
+        EXPECT_TRUE( vector.empty() );
+    }
+}
\ No newline at end of file
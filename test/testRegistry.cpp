@@ -0,0 +1,272 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/reflection.h"
+
+#include "helper.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+namespace
+{
+    class FrozenRegistry
+    {
+    public:
+
+        uint32_t publicU32Property;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "FrozenRegistry" );
+
+            mirror.Reflect( &FrozenRegistry::publicU32Property, 0 );
+        }
+    };
+
+    TEST( P( FrozenRegistry ), SanityCheck )
+    {
+        ReflectionClassTest< FrozenRegistry > test;
+
+        EXPECT_FALSE( Reflect::IsFrozen() );
+
+        Reflect::Freeze();
+
+        EXPECT_TRUE( Reflect::IsFrozen() );
+        EXPECT_TRUE( Reflect::IsRegistered< FrozenRegistry >() );
+        EXPECT_NE( nullptr, Reflect::GetType< FrozenRegistry >() );
+        EXPECT_EQ( Reflect::GetType< FrozenRegistry >(), Reflect::GetType( "FrozenRegistry" ) );
+        EXPECT_EQ( nullptr, Reflect::GetType( "NotRegistered" ) );
+    }
+
+    TEST( P( FrozenRegistry ), ClearThaws )
+    {
+        {
+            ReflectionClassTest< FrozenRegistry > test;
+
+            Reflect::Freeze();
+        }
+
+        EXPECT_FALSE( Reflect::IsFrozen() );
+        EXPECT_FALSE( Reflect::IsRegistered< FrozenRegistry >() );
+    }
+
+    TEST( P( FrozenRegistry ), ConcurrentLookup )
+    {
+        ReflectionClassTest< FrozenRegistry > test;
+
+        Reflect::Freeze();
+
+        const ITypeDescription *expected = Reflect::GetType< FrozenRegistry >();
+        std::atomic< uint32_t > mismatches( 0 );
+        std::vector< std::thread > threads;
+
+        for ( uint32_t i = 0; i < 8; ++i )
+        {
+            threads.emplace_back( [expected, &mismatches]()
+            {
+                for ( uint32_t j = 0; j < 10000; ++j )
+                {
+                    if ( Reflect::GetType< FrozenRegistry >() != expected ||
+                            Reflect::GetType( "FrozenRegistry" ) != expected )
+                    {
+                        ++mismatches;
+                    }
+                }
+            } );
+        }
+
+        for ( std::thread &thread : threads )
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ( 0, mismatches.load() );
+    }
+
+    TEST( P( FrozenRegistry ), ConcurrentRegistration )
+    {
+        std::atomic< const ITypeDescription * > types[8] = {};
+        std::vector< std::thread > threads;
+
+        for ( uint32_t i = 0; i < 8; ++i )
+        {
+            threads.emplace_back( [i, &types]()
+            {
+                for ( uint32_t j = 0; j < 10000; ++j )
+                {
+                    types[i] = Reflect::GetType< FrozenRegistry >();
+                }
+            } );
+        }
+
+        for ( std::thread &thread : threads )
+        {
+            thread.join();
+        }
+
+        EXPECT_FALSE( Reflect::IsFrozen() );
+
+        for ( const std::atomic< const ITypeDescription * > &type : types )
+        {
+            EXPECT_EQ( Reflect::GetType< FrozenRegistry >(), type.load() );
+        }
+
+        Reflect::ClearAll();
+
+        EXPECT_FALSE( Reflect::IsRegistered< FrozenRegistry >() );
+        EXPECT_NE( nullptr, Reflect::GetType< FrozenRegistry >() );
+        EXPECT_TRUE( Reflect::IsRegistered< FrozenRegistry >() );
+
+        Reflect::ClearAll();
+    }
+
+    TEST( P( FrozenRegistry ), ClearTypeReregisters )
+    {
+        ReflectionClassTest< FrozenRegistry > test;
+
+        Reflect::Clear< FrozenRegistry >();
+
+        EXPECT_FALSE( Reflect::IsRegistered< FrozenRegistry >() );
+        EXPECT_EQ( nullptr, Reflect::GetType( "FrozenRegistry" ) );
+
+        EXPECT_NE( nullptr, Reflect::GetType< FrozenRegistry >() );
+        EXPECT_TRUE( Reflect::IsRegistered< FrozenRegistry >() );
+        EXPECT_EQ( Reflect::GetType< FrozenRegistry >(), Reflect::GetType( "FrozenRegistry" ) );
+    }
+
+    TEST( P( FrozenRegistry ), StaticPropertyTypes )
+    {
+        enum class Mode : uint8_t
+        {
+            On
+        };
+
+        ReflectionClassTest< FrozenRegistry > test;
+
+        // the property types are described without registering them
+        EXPECT_FALSE( Reflect::IsRegistered< uint32_t >() );
+        EXPECT_EQ( Reflect::GetType< uint32_t >(), Reflect::GetType< uint32_t >() );
+        EXPECT_EQ( nullptr, Reflect::GetType< uint32_t >()->GetProperties() );
+        EXPECT_EQ( nullptr, Reflect::GetType( Reflect::HashTypeName< uint32_t >() ) );
+
+        Reflect::Freeze();
+
+        // so they remain available once the registry is frozen
+        EXPECT_NE( nullptr, Reflect::GetType< Mode >() );
+        EXPECT_NE( nullptr, Reflect::GetType< const FrozenRegistry * >() );
+        EXPECT_FALSE( Reflect::IsRegistered< Mode >() );
+    }
+
+    TEST( P( TypeTable ), StableSlots )
+    {
+        TypeTable table;
+
+        EXPECT_EQ( nullptr, table.Find( 1 ) );
+        EXPECT_EQ( nullptr, table.Find( TypeTable::ChunkSize * TypeTable::MaxChunks ) );
+
+        ITypeDescription **slot = table.GetSlot( 1 );
+        EXPECT_EQ( nullptr, *slot );
+        EXPECT_EQ( TypeTable::ChunkSize, table.GetCapacity() );
+
+        ITypeDescription *type = reinterpret_cast< ITypeDescription * >( 0x10 );
+        *slot = type;
+
+        EXPECT_EQ( type, table.Find( 1 ) );
+
+        table.GetSlot( 3 * TypeTable::ChunkSize + 2 );
+
+        EXPECT_EQ( slot, table.GetSlot( 1 ) );
+        EXPECT_EQ( type, table.Find( 1 ) );
+        EXPECT_EQ( 4 * TypeTable::ChunkSize, table.GetCapacity() );
+
+        table.Clear();
+
+        EXPECT_EQ( nullptr, table.Find( 1 ) );
+        EXPECT_EQ( slot, table.GetSlot( 1 ) );
+    }
+
+    TEST( P( FrozenRegistry ), NameSliceLookup )
+    {
+        ReflectionClassTest< FrozenRegistry > test;
+
+        const char buffer[] = "xxFrozenRegistryxx";
+        const std::string_view slice( buffer + 2, 14 );
+
+        EXPECT_EQ( Reflect::GetType< FrozenRegistry >(), Reflect::GetType( slice ) );
+        EXPECT_EQ( nullptr, Reflect::GetType( std::string_view( buffer + 2, 13 ) ) );
+
+        Reflect::Freeze();
+
+        EXPECT_EQ( Reflect::GetType< FrozenRegistry >(), Reflect::GetType( slice ) );
+        EXPECT_EQ( nullptr, Reflect::GetType( std::string_view( buffer + 2, 13 ) ) );
+        EXPECT_EQ( nullptr, Reflect::GetType( std::string_view() ) );
+    }
+
+    TEST( P( NameIndex ), Empty )
+    {
+        NameIndex< uint32_t > index;
+
+        EXPECT_EQ( 0, index.GetSize() );
+        EXPECT_EQ( nullptr, index.Find( "name" ) );
+
+        index.Build( {} );
+
+        EXPECT_EQ( nullptr, index.Find( "" ) );
+    }
+
+    TEST( P( NameIndex ), AllNamesResolve )
+    {
+        std::vector< std::string > names;
+
+        for ( uint32_t i = 0; i < 5000; ++i )
+        {
+            names.push_back( "Type" + std::to_string( i ) );
+        }
+
+        std::vector< std::pair< std::string_view, uint32_t > > entries;
+
+        for ( uint32_t i = 0; i < names.size(); ++i )
+        {
+            entries.emplace_back( names[i], i );
+        }
+
+        NameIndex< uint32_t > index;
+        index.Build( entries );
+
+        EXPECT_EQ( names.size(), index.GetSize() );
+
+        for ( uint32_t i = 0; i < names.size(); ++i )
+        {
+            ASSERT_NE( nullptr, index.Find( names[i] ) );
+            EXPECT_EQ( i, *index.Find( names[i] ) );
+        }
+
+        EXPECT_EQ( nullptr, index.Find( "Type5000" ) );
+        EXPECT_EQ( nullptr, index.Find( "Type" ) );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/serializer.h"
+
+#include "helper.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    class Vector3
+    {
+    public:
+
+        float x;
+        float y;
+        float z;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Vector3" );
+
+            mirror.Reflect( &Vector3::x, 0, "x" );
+            mirror.Reflect( &Vector3::y, 1, "y" );
+            mirror.Reflect( &Vector3::z, 2, "z" );
+        }
+    };
+
+    class Tagged
+    {
+    public:
+
+        std::string tag;
+        uint32_t weight;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Tagged" );
+
+            mirror.Reflect( &Tagged::tag, 0, "tag" );
+            mirror.Reflect( &Tagged::weight, 1, "weight" );
+        }
+    };
+
+    class Message
+    {
+    public:
+
+        uint32_t id;
+        uint16_t kind;
+        uint16_t flags;
+        Vector3 position;
+        std::string name;
+        std::vector< float > samples;
+        std::vector< Tagged > tags;
+        Tagged primary;
+        Message *next;
+        uint64_t unreflected;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Message" );
+
+            mirror.Reflect( &Message::id, 0, "id" );
+            mirror.Reflect( &Message::kind, 1, "kind" );
+            mirror.Reflect( &Message::flags, 2, "flags" );
+            mirror.Reflect( &Message::position, 3, "position" );
+            mirror.Reflect( &Message::name, 4, "name" );
+            mirror.Reflect( &Message::samples, 5, "samples" );
+            mirror.Reflect( &Message::tags, 6, "tags" );
+            mirror.Reflect( &Message::primary, 7, "primary" );
+            mirror.Reflect( &Message::next, 8, "next" );
+        }
+    };
+
+    Message CreateMessage()
+    {
+        Message message;
+        message.id = 12;
+        message.kind = 3;
+        message.flags = 0x8001;
+        message.position = { 1.0f, 2.0f, 3.0f };
+        message.name = "message";
+        message.samples = { 0.5f, 1.5f, 2.5f };
+        message.tags = { { "first", 1 }, { "second", 2 } };
+        message.primary = { "primary", 7 };
+        message.next = &message;
+        message.unreflected = 99;
+
+        return message;
+    }
+
+    TEST( P( Serializer ), RoundTrip )
+    {
+        ReflectionClassTest< Message > test;
+
+        const Message message = CreateMessage();
+
+        std::vector< uint8_t > buffer;
+        Reflect::Serialize( message, buffer );
+
+        Message result = {};
+        ASSERT_TRUE( Reflect::Deserialize( buffer, result ) );
+
+        EXPECT_EQ( 12, result.id );
+        EXPECT_EQ( 3, result.kind );
+        EXPECT_EQ( 0x8001, result.flags );
+        EXPECT_EQ( 2.0f, result.position.y );
+        EXPECT_EQ( "message", result.name );
+        EXPECT_EQ( message.samples, result.samples );
+        ASSERT_EQ( 2, result.tags.size() );
+        EXPECT_EQ( "second", result.tags[1].tag );
+        EXPECT_EQ( 2, result.tags[1].weight );
+        EXPECT_EQ( "primary", result.primary.tag );
+        EXPECT_EQ( nullptr, result.next );
+        EXPECT_EQ( 0, result.unreflected );
+    }
+
+    TEST( P( Serializer ), Layout )
+    {
+        ReflectionClassTest< Message > test;
+
+        const Message message = CreateMessage();
+
+        std::vector< uint8_t > buffer;
+        Reflect::Serialize( message, buffer );
+
+        // one run for id, kind and flags, one block for the position, then the counted sequences
+        const size_t expected = 8 + 12 + ( 4 + 7 ) + ( 4 + 3 * 4 ) + ( 4 + ( 4 + 5 + 4 ) + ( 4 + 6 + 4 ) ) + ( 4 + 7 + 4 );
+        ASSERT_EQ( expected, buffer.size() );
+
+        uint32_t id;
+        memcpy( &id, buffer.data(), sizeof( id ) );
+        EXPECT_EQ( 12, id );
+    }
+
+    TEST( P( Serializer ), ReuseTarget )
+    {
+        ReflectionClassTest< Message > test;
+
+        const Message message = CreateMessage();
+
+        std::vector< uint8_t > buffer;
+        Reflect::Serialize( message, buffer );
+
+        Message result = CreateMessage();
+        result.samples.reserve( 64 );
+        const float *samples = result.samples.data();
+
+        ASSERT_TRUE( Reflect::Deserialize( buffer, result ) );
+        EXPECT_EQ( samples, result.samples.data() );
+        EXPECT_EQ( message.samples, result.samples );
+    }
+
+    TEST( P( Serializer ), Truncated )
+    {
+        ReflectionClassTest< Message > test;
+
+        std::vector< uint8_t > buffer;
+        Reflect::Serialize( CreateMessage(), buffer );
+
+        for ( size_t size = 0; size < buffer.size(); ++size )
+        {
+            Message result = {};
+            EXPECT_FALSE( Reflect::Deserialize( buffer.data(), size, result ) );
+        }
+    }
+
+    TEST( P( Serializer ), Plan )
+    {
+        ReflectionClassTest< Message > test;
+
+        const TypePlan &plan = Reflect::GetType< Message >()->GetPlan();
+        ArrayView< PlanOp > ops = plan.GetOps();
+
+        EXPECT_EQ( &plan, &Reflect::GetType< Message >()->GetPlan() );
+        EXPECT_TRUE( Reflect::GetType< Vector3 >()->GetPlan().IsTrivial() );
+
+        ASSERT_EQ( 7, ops.size() );
+
+        // id, kind, flags and the inlined position are one copy
+        EXPECT_EQ( PlanOp::Code::Copy, ops[0].code );
+        EXPECT_EQ( offsetof( Message, id ), ops[0].offset );
+        EXPECT_EQ( 20, ops[0].size );
+
+        EXPECT_EQ( PlanOp::Code::Sequence, ops[1].code );
+        EXPECT_EQ( offsetof( Message, name ), ops[1].offset );
+        EXPECT_EQ( PlanOp::Code::Sequence, ops[2].code );
+        EXPECT_EQ( PlanOp::Code::Sequence, ops[3].code );
+
+        // the primary tag is inlined as well
+        EXPECT_EQ( PlanOp::Code::Sequence, ops[4].code );
+        EXPECT_EQ( offsetof( Message, primary ) + offsetof( Tagged, tag ), ops[4].offset );
+        EXPECT_EQ( PlanOp::Code::Copy, ops[5].code );
+        EXPECT_EQ( offsetof( Message, primary ) + offsetof( Tagged, weight ), ops[5].offset );
+
+        EXPECT_EQ( PlanOp::Code::Pointer, ops[6].code );
+        EXPECT_EQ( 20 + sizeof( uint32_t ), plan.GetCopySize() );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,315 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/taggedSerializer.h"
+
+#include "helper.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    class Item
+    {
+    public:
+
+        std::string name;
+        uint32_t count;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Item" );
+
+            mirror.Reflect( &Item::name, 1, "name" );
+            mirror.Reflect( &Item::count, 2, "count" );
+        }
+    };
+
+    class Header
+    {
+    public:
+
+        uint64_t sequence;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Header" );
+
+            mirror.Reflect( &Header::sequence, 0, "sequence" );
+        }
+    };
+
+    // The first version of a record
+    class RecordV1
+        : public Header
+    {
+    public:
+
+        uint32_t id;
+        std::string owner;
+        std::vector< Item > items;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "RecordV1" );
+
+            mirror.Reflect< RecordV1, Header >( 0 );
+
+            mirror.Reflect( &RecordV1::id, 1, "id" );
+            mirror.Reflect( &RecordV1::owner, 2, "owner" );
+            mirror.Reflect( &RecordV1::items, 3, "items" );
+        }
+    };
+
+    // The second version, which dropped the owner, widened nothing and added fields
+    class RecordV2
+        : public Header
+    {
+    public:
+
+        uint32_t id;
+        std::vector< Item > items;
+        std::vector< double > history;
+        std::vector< std::string > labels;
+        Item primary;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "RecordV2" );
+
+            mirror.Reflect< RecordV2, Header >( 0 );
+
+            mirror.Reflect( &RecordV2::id, 1, "id" );
+            mirror.Reflect( &RecordV2::items, 3, "items" );
+            mirror.Reflect( &RecordV2::history, 4, "history" );
+            mirror.Reflect( &RecordV2::labels, 5, "labels" );
+            mirror.Reflect( &RecordV2::primary, 1000, "primary" );
+        }
+    };
+
+    // A trivially copyable nested struct that gained a field in its second version
+    struct PointV1
+    {
+        float x;
+        float y;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "PointV1" );
+
+            mirror.Reflect( &PointV1::x, 0, "x" );
+            mirror.Reflect( &PointV1::y, 1, "y" );
+        }
+    };
+
+    struct PointV2
+    {
+        float x;
+        float y;
+        float z;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "PointV2" );
+
+            mirror.Reflect( &PointV2::x, 0, "x" );
+            mirror.Reflect( &PointV2::y, 1, "y" );
+            mirror.Reflect( &PointV2::z, 2, "z" );
+        }
+    };
+
+    template< class tPoint >
+    struct Path
+    {
+        tPoint origin;
+        std::vector< tPoint > points;
+        uint32_t id;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( &Path::origin, 0, "origin" );
+            mirror.Reflect( &Path::points, 1, "points" );
+            mirror.Reflect( &Path::id, 2, "id" );
+        }
+    };
+
+    RecordV2 CreateRecord()
+    {
+        RecordV2 record;
+        record.sequence = 1ull << 40;
+        record.id = 300;
+        record.items = { { "first", 1 }, { "second", 2 } };
+        record.history = { 1.0, 2.0, 3.0 };
+        record.labels = { "a", "", "abc" };
+        record.primary = { "primary", 9 };
+
+        return record;
+    }
+
+    TEST( P( TaggedSerializer ), RoundTrip )
+    {
+        ReflectionClassTest< RecordV2 > test;
+
+        const RecordV2 record = CreateRecord();
+
+        std::vector< uint8_t > buffer;
+        Reflect::SerializeTagged( record, buffer );
+
+        RecordV2 result;
+        result.labels = { "stale", "stale", "stale", "stale" };
+        ASSERT_TRUE( Reflect::DeserializeTagged( buffer, result ) );
+
+        EXPECT_EQ( record.sequence, result.sequence );
+        EXPECT_EQ( 300, result.id );
+        ASSERT_EQ( 2, result.items.size() );
+        EXPECT_EQ( "second", result.items[1].name );
+        EXPECT_EQ( 2, result.items[1].count );
+        EXPECT_EQ( record.history, result.history );
+        EXPECT_EQ( record.labels, result.labels );
+        EXPECT_EQ( "primary", result.primary.name );
+        EXPECT_EQ( 9, result.primary.count );
+    }
+
+    TEST( P( TaggedSerializer ), NewToOld )
+    {
+        ReflectionClassTest< RecordV2 > test;
+        Reflect::GetType< RecordV1 >();
+
+        std::vector< uint8_t > buffer;
+        Reflect::SerializeTagged( CreateRecord(), buffer );
+
+        RecordV1 result;
+        result.owner = "unchanged";
+        ASSERT_TRUE( Reflect::DeserializeTagged( buffer, result ) );
+
+        EXPECT_EQ( 1ull << 40, result.sequence );
+        EXPECT_EQ( 300, result.id );
+        EXPECT_EQ( "unchanged", result.owner );
+        ASSERT_EQ( 2, result.items.size() );
+        EXPECT_EQ( "first", result.items[0].name );
+    }
+
+    TEST( P( TaggedSerializer ), OldToNew )
+    {
+        ReflectionClassTest< RecordV1 > test;
+        Reflect::GetType< RecordV2 >();
+
+        RecordV1 record;
+        record.sequence = 5;
+        record.id = 7;
+        record.owner = "owner";
+        record.items = { { "only", 3 } };
+
+        std::vector< uint8_t > buffer;
+        Reflect::SerializeTagged( record, buffer );
+
+        RecordV2 result;
+        ASSERT_TRUE( Reflect::DeserializeTagged( buffer, result ) );
+
+        EXPECT_EQ( 5, result.sequence );
+        EXPECT_EQ( 7, result.id );
+        ASSERT_EQ( 1, result.items.size() );
+        EXPECT_EQ( 3, result.items[0].count );
+        EXPECT_TRUE( result.history.empty() );
+        EXPECT_TRUE( result.primary.name.empty() );
+    }
+
+    TEST( P( TaggedSerializer ), NestedFieldAdded )
+    {
+        ReflectionClassTest< Path< PointV1 > > test;
+        Reflect::GetType< Path< PointV2 > >();
+
+        Path< PointV1 > path = { { 1.0f, 2.0f }, { { 3.0f, 4.0f }, { 5.0f, 6.0f } }, 7 };
+
+        std::vector< uint8_t > buffer;
+        Reflect::SerializeTagged( path, buffer );
+
+        Path< PointV2 > result = { { 0.0f, 0.0f, 9.0f }, {}, 0 };
+        ASSERT_TRUE( Reflect::DeserializeTagged( buffer, result ) );
+
+        EXPECT_EQ( 1.0f, result.origin.x );
+        EXPECT_EQ( 2.0f, result.origin.y );
+        EXPECT_EQ( 9.0f, result.origin.z );
+        ASSERT_EQ( 2, result.points.size() );
+        EXPECT_EQ( 5.0f, result.points[1].x );
+        EXPECT_EQ( 6.0f, result.points[1].y );
+        EXPECT_EQ( 7, result.id );
+
+        buffer.clear();
+        Reflect::SerializeTagged( result, buffer );
+
+        Path< PointV1 > old = {};
+        ASSERT_TRUE( Reflect::DeserializeTagged( buffer, old ) );
+
+        EXPECT_EQ( 1.0f, old.origin.x );
+        EXPECT_EQ( 2.0f, old.origin.y );
+        ASSERT_EQ( 2, old.points.size() );
+        EXPECT_EQ( 3.0f, old.points[0].x );
+        EXPECT_EQ( 7, old.id );
+    }
+
+    TEST( P( TaggedSerializer ), Truncated )
+    {
+        ReflectionClassTest< RecordV2 > test;
+
+        std::vector< uint8_t > buffer;
+        Reflect::SerializeTagged( CreateRecord(), buffer );
+
+        // a prefix that ends between two fields is a valid message, any other prefix must fail without overreading
+        size_t failures = 0;
+
+        for ( size_t size = 1; size < buffer.size(); ++size )
+        {
+            RecordV2 result;
+            failures += Reflect::DeserializeTagged( buffer.data(), size, result ) ? 0 : 1;
+        }
+
+        EXPECT_GE( failures, buffer.size() - 8 );
+
+        RecordV2 result;
+        EXPECT_FALSE( Reflect::DeserializeTagged( buffer.data(), buffer.size() - 1, result ) );
+    }
+
+    TEST( P( TaggedSerializer ), IndexLookup )
+    {
+        ReflectionClassTest< RecordV2 > test;
+
+        const AbstractProperties *properties = Reflect::GetType< RecordV2 >()->GetProperties();
+
+        EXPECT_EQ( "history", properties->FindByIndex( 4 )->GetName() );
+        EXPECT_EQ( "primary", properties->FindByIndex( 1000 )->GetName() );
+        EXPECT_EQ( nullptr, properties->FindByIndex( 0 ) );
+        EXPECT_EQ( nullptr, properties->FindByIndex( 999 ) );
+        EXPECT_EQ( 5, properties->GetDeclaredView().size() );
+
+        const AbstractProperties *items = Reflect::GetType< Item >()->GetProperties();
+
+        EXPECT_EQ( "count", items->FindByIndex( 2 )->GetName() );
+        EXPECT_EQ( nullptr, items->FindByIndex( 3 ) );
+        EXPECT_EQ( nullptr, items->FindByIndex( 100000 ) );
+    }
+}
\ No newline at end of file
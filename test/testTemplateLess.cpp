@@ -107,4 +107,28 @@ namespace
         EXPECT_EQ( 2, properties->GetAll()[1]->Get< uint32_t >( variable ) );
         EXPECT_EQ( 3, properties->GetAll()[2]->Get< uint32_t >( variable ) );
     }
+
+    TEST( P( TestClass ), View )
+    {
+        ReflectionClassTest< TestClass > test;
+
+        const AbstractProperties *properties = Reflect::GetType( "TestClass" )->GetProperties();
+        ArrayView< AbstractProperty * > view = properties->GetView();
+
+        ASSERT_EQ( 3, view.size() );
+        EXPECT_EQ( properties->GetAll(), view.ToVector() );
+        EXPECT_EQ( view.data(), properties->GetView().data() );
+
+        TestClass variable;
+        uint32_t value = 1;
+
+        for ( AbstractProperty *property : view )
+        {
+            property->Set( variable, value++ );
+        }
+
+        EXPECT_EQ( 1, view[0]->Get< uint32_t >( variable ) );
+        EXPECT_EQ( 2, view[1]->Get< uint32_t >( variable ) );
+        EXPECT_EQ( 3, view[2]->Get< uint32_t >( variable ) );
+    }
 }
\ No newline at end of file
@@ -28,6 +28,15 @@
 
 #include "helper.h"
 
+#include <algorithm>
+
+namespace TypeNames
+{
+    class Named
+    {
+    };
+}
+
 namespace
 {
 
@@ -47,4 +56,172 @@ namespace
         EXPECT_TRUE( properties->GetIndices().empty() );
     }
 
+    class DeclaredTypeID
+    {
+    public:
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "DeclaredTypeID", 0x5EED5EED5EED5EEDULL );
+        }
+    };
+
+    static_assert( Reflect::HashTypeName< NoReflect >() != Reflect::HashTypeName< DeclaredTypeID >(),
+                   "Type name hashes should be available at compile time." );
+
+    TEST( P( NoReflect ), TypeID )
+    {
+        ReflectionClassTest< NoReflect > test;
+
+        EXPECT_EQ( Reflect::HashTypeName< NoReflect >(), Reflect::GetType< NoReflect >()->GetTypeID() );
+        EXPECT_EQ( Reflect::GetType< NoReflect >(), Reflect::GetType( Reflect::HashTypeName< NoReflect >() ) );
+        EXPECT_EQ( nullptr, Reflect::GetType( Reflect::HashTypeName< DeclaredTypeID >() ) );
+    }
+
+    static_assert( ReflectionHelper::TypeName< TypeNames::Named >() == "TypeNames::Named",
+                   "Only the type name should be extracted from the signature." );
+
+    TEST( P( NoReflect ), TypeNameHash )
+    {
+        EXPECT_EQ( "unsigned int", ReflectionHelper::TypeName< uint32_t >() );
+        EXPECT_EQ( ReflectionHelper::HashString( "TypeNames::Named" ), Reflect::HashTypeName< TypeNames::Named >() );
+        EXPECT_NE( Reflect::HashTypeName< uint32_t >(), Reflect::HashTypeName< uint64_t >() );
+    }
+
+    TEST( P( DeclaredTypeID ), TypeID )
+    {
+        ReflectionClassTest< DeclaredTypeID > test;
+
+        EXPECT_EQ( 0x5EED5EED5EED5EEDULL, Reflect::GetType< DeclaredTypeID >()->GetTypeID() );
+        EXPECT_EQ( Reflect::GetType< DeclaredTypeID >(), Reflect::GetType( 0x5EED5EED5EED5EEDULL ) );
+        EXPECT_EQ( nullptr, Reflect::GetType( Reflect::HashTypeName< DeclaredTypeID >() ) );
+
+        Reflect::Clear< DeclaredTypeID >();
+
+        EXPECT_EQ( nullptr, Reflect::GetType( 0x5EED5EED5EED5EEDULL ) );
+    }
+
+    class CollidingTypeID
+    {
+    public:
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "CollidingTypeID", 0x5EED5EED5EED5EEDULL );
+        }
+    };
+
+    TEST( P( DeclaredTypeID ), Collision )
+    {
+        ReflectionClassTest< DeclaredTypeID > test;
+
+        EXPECT_THROW( Reflect::GetType< CollidingTypeID >(), std::logic_error );
+
+        EXPECT_FALSE( Reflect::IsRegistered< CollidingTypeID >() );
+        EXPECT_EQ( nullptr, Reflect::GetType( "CollidingTypeID" ) );
+        EXPECT_EQ( Reflect::GetType< DeclaredTypeID >(), Reflect::GetType( 0x5EED5EED5EED5EEDULL ) );
+
+        Reflect::Clear< DeclaredTypeID >();
+
+        EXPECT_EQ( 0x5EED5EED5EED5EEDULL, Reflect::GetType< CollidingTypeID >()->GetTypeID() );
+        EXPECT_EQ( Reflect::GetType< CollidingTypeID >(), Reflect::GetType( 0x5EED5EED5EED5EEDULL ) );
+    }
+
+    class Plain
+    {
+    public:
+
+        uint32_t value;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "FlagsPlain" );
+
+            mirror.Reflect( &Plain::value, 0, "value" );
+        }
+    };
+
+    class Shape
+    {
+    public:
+
+        virtual ~Shape() = default;
+
+        float area;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "FlagsShape" );
+
+            mirror.Reflect( &Shape::area, 0, "area" );
+        }
+    };
+
+    class Circle
+        : public Shape
+    {
+    public:
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "FlagsCircle" );
+
+            mirror.Reflect< Circle, Shape >( 0 );
+        }
+    };
+
+    typedef ITypeDescription::Type Type;
+
+    static_assert( TypeDescription< Plain >::Flags & Type::IsPOD, "Type flags should be available at compile time." );
+    static_assert( !( TypeDescription< Plain >::Flags & Type::IsEnum ), "Every trait should be stored." );
+    static_assert( TypeDescription< uint32_t >::Flags == ( Type::IsIntegral | Type::IsArithmetic |
+                                                           Type::IsFundamental | Type::IsObject | Type::IsScalar |
+                                                           Type::IsLiteral | Type::IsPOD | Type::IsStandardLayout |
+                                                           Type::IsTrivial | Type::IsUnsigned ),
+                   "The traits of an unsigned integer." );
+
+    bool Contains( const std::vector< const ITypeDescription * > &types, const ITypeDescription *type )
+    {
+        return std::find( types.begin(), types.end(), type ) != types.end();
+    }
+
+    TEST( P( TypeFlags ), Flags )
+    {
+        ReflectionClassTest< Circle > test;
+
+        EXPECT_TRUE( Reflect::GetType< Plain >()->HasFlags( Type::IsClass | Type::IsObject | Type::IsPOD |
+                                                             Type::HasReflectedProperties ) );
+        EXPECT_FALSE( Reflect::GetType< Plain >()->HasFlags( Type::IsPolymorphic ) );
+        EXPECT_TRUE( Reflect::GetType< Circle >()->HasFlags( Type::IsPolymorphic | Type::HasReflectedProperties ) );
+        EXPECT_FALSE( Reflect::GetType< NoReflect >()->HasFlags( Type::HasReflectedProperties ) );
+        EXPECT_EQ( TypeDescription< float >::Flags, Reflect::GetType< float >()->GetFlags() );
+    }
+
+    TEST( P( TypeFlags ), FindTypes )
+    {
+        ReflectionClassTest< Circle > test;
+
+        Reflect::GetType< Plain >();
+        Reflect::GetType< NoReflect >();
+
+        const std::vector< const ITypeDescription * > polymorphic =
+            Reflect::FindTypes( Type::IsPolymorphic | Type::HasReflectedProperties );
+        ASSERT_EQ( 2u, polymorphic.size() );
+        EXPECT_TRUE( Contains( polymorphic, Reflect::GetType< Shape >() ) );
+        EXPECT_TRUE( Contains( polymorphic, Reflect::GetType< Circle >() ) );
+
+        const std::vector< const ITypeDescription * > pod = Reflect::FindTypes( Type::IsPOD );
+        ASSERT_EQ( 2u, pod.size() );
+        EXPECT_TRUE( Contains( pod, Reflect::GetType< Plain >() ) );
+        EXPECT_TRUE( Contains( pod, Reflect::GetType< NoReflect >() ) );
+
+        EXPECT_EQ( 4u, Reflect::FindTypes( 0 ).size() );
+        EXPECT_TRUE( Reflect::FindTypes( Type::IsEnum ).empty() );
+
+        Reflect::Clear< Plain >();
+        EXPECT_EQ( 1u, Reflect::FindTypes( Type::IsPOD ).size() );
+
+        Reflect::Freeze();
+        EXPECT_EQ( 2u, Reflect::FindTypes( Type::IsPolymorphic ).size() );
+    }
 }
\ No newline at end of file
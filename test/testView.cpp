@@ -0,0 +1,168 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/view.h"
+
+#include "helper.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+    class Point
+    {
+    public:
+
+        float x;
+        float y;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Point" );
+
+            mirror.Reflect( &Point::x, 0, "x" );
+            mirror.Reflect( &Point::y, 1, "y" );
+        }
+    };
+
+    class Sample
+    {
+    public:
+
+        uint64_t id;
+        Point position;
+        uint16_t channel;
+        uint32_t unreflected;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( "Sample" );
+
+            mirror.Reflect( &Sample::id, 0, "id" );
+            mirror.Reflect( &Sample::position, 1, "position" );
+            mirror.Reflect( &Sample::channel, 2, "channel" );
+        }
+    };
+
+    std::vector< Sample > CreateSamples()
+    {
+        std::vector< Sample > samples( 100 );
+
+        for ( size_t i = 0; i < samples.size(); ++i )
+        {
+            samples[i] = { i, { i * 1.0f, i * 2.0f }, static_cast< uint16_t >( i % 7 ), 5 };
+        }
+
+        return samples;
+    }
+
+    TEST( P( View ), ReadInPlace )
+    {
+        ReflectionClassTest< Sample > test;
+
+        std::vector< uint8_t > buffer;
+        Reflect::WriteView( CreateSamples(), buffer );
+
+        EXPECT_EQ( ViewHeader::DataOffset + 100 * sizeof( Sample ), buffer.size() );
+
+        const ObjectView< Sample > view = Reflect::View< Sample >( buffer.data(), buffer.size() );
+        ASSERT_TRUE( view.IsValid() );
+        ASSERT_EQ( 100, view.size() );
+
+        const Properties< Sample > *properties = Reflect::GetType< Sample >()->GetProperties();
+
+        EXPECT_EQ( 42, view.Get( 42, &Sample::id ) );
+        EXPECT_EQ( 3, view.Get< uint16_t >( 10, properties->GetByMemberPtr( &Sample::channel ) ) );
+        EXPECT_EQ( 84.0f, view.Get( 42, &Sample::position ).y );
+        EXPECT_EQ( 0, view.Get( 42, &Sample::unreflected ) );
+
+        // the record is a valid object for the property interface
+        AbstractProperty *id = properties->GetByMemberPtr( &Sample::id );
+        EXPECT_EQ( 99, *static_cast< const uint64_t * >( id->Get( const_cast< void * >( view.GetRecord( 99 ) ) ) ) );
+    }
+
+    TEST( P( View ), Validation )
+    {
+        ReflectionClassTest< Sample > test;
+
+        std::vector< uint8_t > buffer;
+        Reflect::WriteView( CreateSamples(), buffer );
+
+        EXPECT_FALSE( Reflect::View< Sample >( buffer.data(), buffer.size() - 1 ).IsValid() );
+        EXPECT_FALSE( Reflect::View< Sample >( buffer.data(), 16 ).IsValid() );
+        EXPECT_FALSE( Reflect::View< Point >( buffer.data(), buffer.size() ).IsValid() );
+
+        std::vector< uint8_t > version = buffer;
+        version[4] = 2;
+        EXPECT_FALSE( Reflect::View< Sample >( version.data(), version.size() ).IsValid() );
+
+        std::vector< uint8_t > layout = buffer;
+        layout[16] ^= 1;
+        EXPECT_FALSE( Reflect::View< Sample >( layout.data(), layout.size() ).IsValid() );
+
+        std::vector< uint8_t > empty;
+        Reflect::WriteView( std::vector< Sample >(), empty );
+        EXPECT_TRUE( Reflect::View< Sample >( empty.data(), empty.size() ).empty() );
+    }
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+    TEST( P( View ), MappedFile )
+    {
+        ReflectionClassTest< Sample > test;
+
+        std::vector< uint8_t > buffer;
+        Reflect::WriteView( CreateSamples(), buffer );
+
+        char path[] = "/tmp/reflection-view-XXXXXX";
+        const int descriptor = mkstemp( path );
+        ASSERT_GE( descriptor, 0 );
+
+        FILE *file = fdopen( descriptor, "wb" );
+        ASSERT_EQ( buffer.size(), fwrite( buffer.data(), 1, buffer.size(), file ) );
+        fclose( file );
+
+        {
+            MappedFile mapped( path );
+            ASSERT_TRUE( mapped.IsOpen() );
+            EXPECT_EQ( buffer.size(), mapped.GetSize() );
+
+            const ObjectView< Sample > view = Reflect::View< Sample >( mapped );
+            ASSERT_TRUE( view.IsValid() );
+            EXPECT_EQ( 77, view.Get( 77, &Sample::id ) );
+            EXPECT_EQ( 77.0f, view.Get( 77, &Sample::position ).x );
+        }
+
+        remove( path );
+
+        EXPECT_FALSE( MappedFile( path ).IsOpen() );
+    }
+
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,249 @@
+/**
+ * @cond ___LICENSE___
+ *
+ * Copyright (c) 2016 Koen Visscher, Paul Visscher and individual contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @endcond
+ */
+
+#include "reflection/reflection.h"
+
+#include "helper.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    class VisitedBase
+    {
+    public:
+
+        uint32_t base;
+
+        template< class tMirror >
+        static void Reflect( tMirror &mirror )
+        {
+            mirror.Reflect( "VisitedBase" );
+
+            mirror.Reflect( &VisitedBase::base, 0, "base" );
+        }
+    };
+
+    class Visited
+        : public VisitedBase
+    {
+    public:
+
+        float value;
+        uint8_t flags;
+
+        template< class tMirror >
+        static void Reflect( tMirror &mirror )
+        {
+            mirror.Reflect( "Visited" );
+
+            mirror.template Reflect< Visited, VisitedBase >( 0 );
+
+            mirror.Reflect( &Visited::value, 0, "value", "A value" );
+            mirror.Reflect( &Visited::flags, 1, 0x04u, Accessibility::Protected, "flags" );
+        }
+    };
+
+    class Declared
+    {
+    public:
+
+        uint32_t hidden;
+        uint32_t flagged;
+        uint32_t plain;
+
+        template< class tMirror >
+        static void Reflect( tMirror &mirror )
+        {
+            mirror.Reflect( "Declared" );
+
+            mirror.Reflect( &Declared::hidden, 0, Accessibility::Private, "hidden" );
+            mirror.Reflect( &Declared::flagged, 1u, Accessibility::Protected, 0x02u, "flagged", "Flags" );
+            mirror.Reflect( &Declared::plain, 2u, 0x08u, "plain" );
+        }
+    };
+
+    struct Limits
+    {
+        uint32_t maximum;
+    };
+
+    class Annotated
+    {
+    public:
+
+        uint32_t count;
+
+        template< class tMirror >
+        static void Reflect( tMirror &mirror )
+        {
+            mirror.Reflect( "Annotated" );
+
+            mirror.Reflect( &Annotated::count, 0, "count" );
+            mirror.Attribute( &Annotated::count, Limits{ 10 } );
+        }
+    };
+
+    class RuntimeOnly
+    {
+    public:
+
+        uint32_t value;
+
+        static void Reflect( Mirror &mirror )
+        {
+            mirror.Reflect( &RuntimeOnly::value, 0, "value" );
+        }
+    };
+
+    struct Collector
+    {
+        std::vector< std::string > names;
+        double sum = 0.0;
+
+        template< typename tProperty >
+        void operator()( const tProperty &value, const StaticProperty &property )
+        {
+            names.push_back( property.name );
+            sum += value;
+        }
+    };
+
+    TEST( P( Visitor ), ForEachProperty )
+    {
+        Visited object;
+        object.base = 1;
+        object.value = 2.5f;
+        object.flags = 4;
+
+        Collector collector;
+        Reflect::ForEachProperty( object, collector );
+
+        EXPECT_EQ( std::vector< std::string >( { "base", "value", "flags" } ), collector.names );
+        EXPECT_EQ( 7.5, collector.sum );
+        EXPECT_FALSE( Reflect::IsRegistered< Visited >() );
+    }
+
+    TEST( P( Visitor ), Declarations )
+    {
+        const Visited object = {};
+        std::vector< StaticProperty > properties;
+
+        Reflect::ForEachProperty( object, [&properties]( const auto &, const StaticProperty &property )
+        {
+            properties.push_back( property );
+        } );
+
+        ASSERT_EQ( 3, properties.size() );
+        EXPECT_STREQ( "A value", properties[1].description );
+        EXPECT_EQ( 1, properties[2].index );
+        EXPECT_EQ( 0x04u, properties[2].customFlags );
+        EXPECT_EQ( Accessibility::Protected, properties[2].accessibility );
+    }
+
+    TEST( P( Visitor ), AccessibilityAndFlags )
+    {
+        Declared object = { 1, 2, 3 };
+        std::vector< StaticProperty > properties;
+        uint32_t sum = 0;
+
+        Reflect::ForEachProperty( object, [&properties, &sum]( uint32_t value, const StaticProperty &property )
+        {
+            properties.push_back( property );
+            sum += value;
+        } );
+
+        ASSERT_EQ( 3, properties.size() );
+        EXPECT_EQ( 6u, sum );
+        EXPECT_EQ( Accessibility::Private, properties[0].accessibility );
+        EXPECT_EQ( 0x00u, properties[0].customFlags );
+        EXPECT_EQ( 1, properties[1].index );
+        EXPECT_EQ( Accessibility::Protected, properties[1].accessibility );
+        EXPECT_EQ( 0x02u, properties[1].customFlags );
+        EXPECT_STREQ( "Flags", properties[1].description );
+        EXPECT_EQ( Accessibility::Public, properties[2].accessibility );
+        EXPECT_EQ( 0x08u, properties[2].customFlags );
+
+        ReflectionClassTest< Declared > test;
+
+        EXPECT_EQ( 3, Reflect::GetType< Declared >()->GetProperties()->GetAll().size() );
+    }
+
+    TEST( P( Visitor ), Attributes )
+    {
+        Annotated object = { 4 };
+        uint32_t visited = 0;
+
+        Reflect::ForEachProperty( object, [&visited]( uint32_t value, const StaticProperty & )
+        {
+            visited += value;
+        } );
+
+        EXPECT_EQ( 4u, visited );
+
+        ReflectionClassTest< Annotated > test;
+
+        const Property< Annotated, uint32_t > *count =
+            Reflect::GetType< Annotated >()->GetProperties()->GetByMemberPtr( &Annotated::count );
+
+        ASSERT_NE( nullptr, count->GetAttribute< Limits >() );
+        EXPECT_EQ( 10u, count->GetAttribute< Limits >()->maximum );
+    }
+
+    TEST( P( Visitor ), Modify )
+    {
+        Visited object = {};
+
+        Reflect::ForEachProperty( object, []( auto &value, const StaticProperty & )
+        {
+            value = 3;
+        } );
+
+        EXPECT_EQ( 3, object.base );
+        EXPECT_EQ( 3.0f, object.value );
+        EXPECT_EQ( 3, object.flags );
+    }
+
+    TEST( P( Visitor ), SharedDeclarations )
+    {
+        ReflectionClassTest< Visited > test;
+
+        Visited object = {};
+        object.value = 2.5f;
+
+        const Properties< Visited > *properties = Reflect::GetType< Visited >()->GetProperties();
+
+        EXPECT_EQ( "Visited", Reflect::GetType< Visited >()->GetName() );
+        EXPECT_EQ( 3, properties->GetAll().size() );
+        EXPECT_EQ( 2.5f, properties->GetByMemberPtr( &Visited::value )->Get( object ) );
+        EXPECT_EQ( 1, Reflect::GetType< Visited >()->GetBaseClasses().size() );
+
+        EXPECT_TRUE( ReflectionHelper::HasStaticReflect< Visited >::value );
+        EXPECT_FALSE( ReflectionHelper::HasStaticReflect< RuntimeOnly >::value );
+        EXPECT_TRUE( ReflectionHelper::HasReflect< RuntimeOnly >::value );
+    }
+}
\ No newline at end of file